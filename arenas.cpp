@@ -0,0 +1,241 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+using std::atomic;
+
+#include "main.h"
+#include "arenas.h"
+#include "jemalloc_custom.h"
+
+/* jemalloc gets memory from the system in chunks (4MiB by default). A chunk
+ * either belongs to a single arena or holds one huge block, so labelling
+ * chunks is enough to attribute every block. The chunk table has an entry for
+ * each chunk of the 47-bit user address space; it is mapped with
+ * MAP_NORESERVE, so only the pages for chunks that are actually used get
+ * backed, and looking up a block is one load.
+ *
+ * jemalloc 3.6 has no hook for chunk allocation, and it recycles freed chunks
+ * without calling mmap, so wrapped_mmap can't fill in the table. Instead every
+ * allocation checks the entries of its chunks and claims them if they name
+ * someone else. That only writes when a chunk changes hands, which is also
+ * when the chunk is relabelled in the memory map.
+ *
+ * jemalloc itself can't be asked whether a pointer is a live block, and
+ * freeing anything else corrupts the heap. So each chunk an arena block starts
+ * in gets two bitmaps with a bit per 8 bytes, the smallest block size: one
+ * marks where live blocks start, the other which of them came from
+ * AllocatePages. A chunk keeps its bitmaps when it changes hands; by then all
+ * of its blocks have been freed and the bits are clear.
+ */
+
+#define ADDRESS_BITS 47
+#define MAX_ARENA_OWNERS 4096
+
+struct image_arena
+{
+	unsigned index; // jemalloc arena
+	atomic<size_t> live{0};
+	atomic<size_t> peak{0};
+	atomic<unsigned long> allocations{0};
+	atomic<unsigned long> frees{0};
+};
+
+static bool g_enabled=false;
+static unsigned g_lg_chunk=0;
+static size_t g_chunks=0;
+static atomic<owner_id>* g_chunk_owner=NULL; // 0 if not in an arena
+static atomic<atomic<UINT64>*>* g_chunk_blocks=NULL; // live bits, then pages bits
+static size_t g_bitmap_words=0;
+static atomic<image_arena*> g_arenas[MAX_ARENA_OWNERS]; // by owner
+static std::mutex g_lock;
+
+static size_t chunk_index(intptr_t addr)
+{
+	return (uintptr_t)addr>>g_lg_chunk;
+}
+
+static void* chunk_start(size_t i)
+{
+	return (void*)(i<<g_lg_chunk);
+}
+
+static atomic<UINT64>* chunk_bitmaps(size_t i,bool create)
+{
+	atomic<UINT64>* bits=g_chunk_blocks[i].load(std::memory_order_acquire);
+	if (bits || !create) return bits;
+	bits=new atomic<UINT64>[2*g_bitmap_words]();
+	atomic<UINT64>* other=NULL;
+	if (g_chunk_blocks[i].compare_exchange_strong(other,bits,std::memory_order_acq_rel)) return bits;
+	delete[] bits;
+	return other;
+}
+
+static size_t bit_word(void* p)
+{
+	return ((uintptr_t)p&(((uintptr_t)1<<g_lg_chunk)-1))>>9;
+}
+
+static UINT64 bit_mask(void* p)
+{
+	return (UINT64)1<<(((uintptr_t)p>>3)&63);
+}
+
+bool arenas_init()
+{
+	size_t lg_chunk,len=sizeof(lg_chunk);
+	if (__jemalloc_mallctl("opt.lg_chunk",&lg_chunk,&len,NULL,0))
+	{
+		fprintf(stderr,"Unable to query the jemalloc chunk size\n");
+		return false;
+	}
+	size_t chunks=(size_t)1<<(ADDRESS_BITS-lg_chunk);
+	size_t owners_size=chunks*sizeof(atomic<owner_id>);
+	void* table=mmap(NULL,owners_size+chunks*sizeof(atomic<atomic<UINT64>*>),PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE,-1,0);
+	if (table==MAP_FAILED)
+	{
+		perror("mmap");
+		return false;
+	}
+	g_chunk_owner=(atomic<owner_id>*)table;
+	g_chunk_blocks=(atomic<atomic<UINT64>*>*)((char*)table+owners_size);
+	g_lg_chunk=lg_chunk;
+	g_chunks=chunks;
+	g_bitmap_words=((size_t)1<<lg_chunk)/8/64;
+	g_enabled=true;
+	return true;
+}
+
+void arenas_add_image(owner_id owner)
+{
+	if (!g_enabled) return;
+	if (owner>=MAX_ARENA_OWNERS)
+	{
+		fprintf(stdout,"Arenas: more than %d owners, %s allocates from the shared heap\n",MAX_ARENA_OWNERS,owner_name(owner));
+		return;
+	}
+	std::lock_guard<std::mutex> lock(g_lock);
+	if (g_arenas[owner].load(std::memory_order_relaxed)) return; // loaded again
+	unsigned index;
+	size_t len=sizeof(index);
+	if (__jemalloc_mallctl("arenas.extend",&index,&len,NULL,0))
+	{
+		fprintf(stdout,"Arenas: unable to create an arena for %s\n",owner_name(owner));
+		return;
+	}
+	image_arena* arena=new image_arena;
+	arena->index=index;
+	g_arenas[owner].store(arena,std::memory_order_release);
+}
+
+// Points the entries for the chunks of [p,p+size) at owner
+static void claim_chunks(void* p,size_t size,owner_id owner)
+{
+	size_t last=std::min(chunk_index((intptr_t)p+size-1),g_chunks-1);
+	for (size_t i=chunk_index((intptr_t)p);i<=last;i++)
+	{
+		if (g_chunk_owner[i].load(std::memory_order_relaxed)==owner) continue;
+		g_chunk_owner[i].store(owner,std::memory_order_relaxed);
+		if (owner)
+			register_memory({chunk_start(i),(size_t)1<<g_lg_chunk,owner,MEMORY_HEAP});
+		else
+			unregister_memory(chunk_start(i),(size_t)1<<g_lg_chunk);
+	}
+}
+
+void* arena_alloc(owner_id owner,size_t* size,memory_kind kind)
+{
+	if (!g_enabled || owner>=MAX_ARENA_OWNERS) return NULL;
+	image_arena* arena=g_arenas[owner].load(std::memory_order_acquire);
+	if (!arena) return NULL;
+
+	// jemalloc doesn't take zero-sized requests
+	void* p=__jemalloc_mallocx(std::max<size_t>(*size,1),MALLOCX_ARENA(arena->index));
+	if (!p) return NULL;
+	size_t i=chunk_index((intptr_t)p);
+	if (i>=g_chunks)
+	{
+		__jemalloc_dallocx(p,0);
+		return NULL;
+	}
+	*size=__jemalloc_sallocx(p,0);
+	claim_chunks(p,*size,owner);
+	atomic<UINT64>* bits=chunk_bitmaps(i,true);
+	if (kind==MEMORY_PAGES) bits[g_bitmap_words+bit_word(p)].fetch_or(bit_mask(p),std::memory_order_relaxed);
+	bits[bit_word(p)].fetch_or(bit_mask(p),std::memory_order_release);
+
+	size_t live=arena->live.fetch_add(*size,std::memory_order_relaxed)+*size;
+	size_t peak=arena->peak.load(std::memory_order_relaxed);
+	while (live>peak && !arena->peak.compare_exchange_weak(peak,live,std::memory_order_relaxed));
+	arena->allocations.fetch_add(1,std::memory_order_relaxed);
+	return p;
+}
+
+void arena_release_chunks(void* p)
+{
+	if (g_enabled) claim_chunks(p,__jemalloc_sallocx(p,0),0);
+}
+
+bool arena_lookup(void* p,memory_block& block)
+{
+	if (!g_enabled) return false;
+	size_t i=chunk_index((intptr_t)p);
+	owner_id owner=i<g_chunks ? g_chunk_owner[i].load(std::memory_order_relaxed) : 0;
+	if (!owner) return false;
+	memory_kind kind=MEMORY_HEAP;
+	atomic<UINT64>* bits=chunk_bitmaps(i,false);
+	if (bits && !((intptr_t)p&7) && (bits[bit_word(p)].load(std::memory_order_acquire)&bit_mask(p)))
+		kind=(bits[g_bitmap_words+bit_word(p)].load(std::memory_order_relaxed)&bit_mask(p)) ? MEMORY_PAGES : MEMORY_POOL;
+	block={p,0,owner,kind};
+	return true;
+}
+
+bool arena_free(const memory_block& block)
+{
+	void* p=block.start;
+	atomic<UINT64>* bits=chunk_bitmaps(chunk_index((intptr_t)p),false);
+	// whoever clears the bit frees the block
+	if (!(bits[bit_word(p)].fetch_and(~bit_mask(p),std::memory_order_acq_rel)&bit_mask(p))) return false;
+	bits[g_bitmap_words+bit_word(p)].fetch_and(~bit_mask(p),std::memory_order_relaxed);
+
+	// Naming the arena keeps the block out of the thread cache, where the
+	// next allocation outside the arenas could pick it up.
+	image_arena* arena=g_arenas[block.owner].load(std::memory_order_acquire);
+	__jemalloc_dallocx(p,MALLOCX_ARENA(arena->index));
+	arena->live.fetch_sub(block.size,std::memory_order_relaxed);
+	arena->frees.fetch_add(1,std::memory_order_relaxed);
+	return true;
+}
+
+void arenas_report()
+{
+	if (!g_enabled) return;
+	for (owner_id owner=0;owner<MAX_ARENA_OWNERS;owner++)
+	{
+		image_arena* arena=g_arenas[owner].load(std::memory_order_acquire);
+		if (!arena) continue;
+		fprintf(stdout,"Arena %s: %lu allocations, %lu frees, peak %zu bytes, at exit %zu bytes\n",owner_name(owner),
+			arena->allocations.load(),arena->frees.load(),arena->peak.load(),arena->live.load());
+	}
+}
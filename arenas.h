@@ -0,0 +1,54 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef ARENAS_H
+#define ARENAS_H
+
+#include "main.h"
+
+// Per-image allocator arenas. Every image loaded by run_pe gets its own
+// jemalloc arena for AllocatePool and AllocatePages, and a table indexed by
+// heap chunk tells which image a chunk belongs to. Allocations from an arena
+// are not registered one by one in the memory map: the chunk is labelled with
+// the image instead, and FreePool finds the owner with one table lookup and
+// checks that it frees a live block in a bitmap per chunk.
+bool arenas_init();
+void arenas_add_image(owner_id owner);
+
+// Allocates *size bytes from the arena of owner and stores the usable size in
+// *size. kind is MEMORY_POOL or MEMORY_PAGES. Returns NULL if owner has no
+// arena, in which case the caller allocates and tracks the block as usual.
+void* arena_alloc(owner_id owner,size_t* size,memory_kind kind);
+
+// Called for blocks allocated outside the arenas, so that a chunk jemalloc
+// recycled from an arena is no longer attributed to its image.
+void arena_release_chunks(void* p);
+
+// If p lies in an arena chunk, fills in block with the image and offset 0
+// and returns true. block.kind is the kind p was allocated as if it is the
+// start of a live block, and MEMORY_HEAP otherwise.
+bool arena_lookup(void* p,memory_block& block);
+
+// Frees a live block found by arena_lookup, with block.size set to its
+// usable size. Returns false if another thread freed it first.
+bool arena_free(const memory_block& block);
+
+void arenas_report();
+
+#endif //ARENAS_H
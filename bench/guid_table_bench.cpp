@@ -0,0 +1,103 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+// Compares protocol lookups in the old unordered_multimap registry against
+// guid_table. Run as: bench/guid_table_bench [iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+using std::pair;
+using std::vector;
+
+#include <efi.h>
+#include "guid_table.hpp"
+extern "C" {
+#include "efi_guid.h"
+}
+
+constexpr bool operator==(EFI_GUID const& s1, EFI_GUID const& s2)
+{
+	return ((UINT64*)&s1)[0]==((UINT64*)&s2)[0] && ((UINT64*)&s1)[1]==((UINT64*)&s2)[1];
+}
+
+struct xor_guid_hash
+{
+	size_t operator()(EFI_GUID const& s) const
+	{
+		return ((UINT64*)&s)[0]^((UINT64*)&s)[1];
+	}
+};
+
+static double now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return ts.tv_sec+ts.tv_nsec*1e-9;
+}
+
+template<typename F> static void run(const char* name,size_t iterations,const vector<EFI_GUID*>& queries,F lookup)
+{
+	uintptr_t sink=0;
+	double start=now();
+	for (size_t i=0;i<iterations;i++)
+		sink+=(uintptr_t)lookup(*queries[i%queries.size()]);
+	double elapsed=now()-start;
+	printf("%-24s %8.2f ns/lookup (%lx)\n",name,elapsed*1e9/iterations,(unsigned long)(sink&0xf));
+}
+
+int main(int argc,char** argv)
+{
+	size_t iterations=argc>1 ? strtoul(argv[1],NULL,0) : 20000000;
+
+	std::unordered_multimap<EFI_GUID,pair<EFI_HANDLE,void*>,xor_guid_hash> multimap;
+	guid_table<vector<pair<EFI_HANDLE,void*>>> table;
+	size_t n=0;
+	for (guid_name* p=g_guid_names;p->guid;p++,n++)
+	{
+		multimap.emplace(*p->guid,std::make_pair((EFI_HANDLE)NULL,(void*)p));
+		table[*p->guid].emplace_back((EFI_HANDLE)NULL,(void*)p);
+	}
+
+	// Lookups in traces are heavily skewed towards a few protocols, so mix a
+	// small hot set with a uniform sweep over the whole table.
+	vector<EFI_GUID*> queries;
+	srand(1);
+	for (size_t i=0;i<4096;i++)
+	{
+		size_t idx=(i%4) ? rand()%16 : rand()%n;
+		queries.push_back(g_guid_names[idx].guid);
+	}
+
+	printf("%zu GUIDs, %zu lookups\n",n,iterations);
+	run("unordered_multimap",iterations,queries,[&](EFI_GUID& g) -> void* {
+		auto range=multimap.equal_range(g);
+		return range.first!=range.second ? range.first->second.second : NULL;
+	});
+	run("guid_table",iterations,queries,[&](EFI_GUID& g) -> void* {
+		auto* entries=table.find(g);
+		return entries ? (*entries)[0].second : NULL;
+	});
+
+	return 0;
+}
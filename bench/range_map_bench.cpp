@@ -0,0 +1,253 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+// Replays a synthetic allocation trace against range_map and flat_range_map
+// the way efiperun uses g_memory_map: heap chunks are registered as they are
+// mapped, each allocation re-labels part of a chunk (erase + insert), and
+// memory accesses look up random addresses inside live allocations. Labels
+// are either full strings or interned memory_owner IDs.
+// A second part runs the same pattern on 1 to 8 threads at once, each
+// registering and looking up its own allocations, against a flat_range_map
+// behind a mutex and against memtrack's sharded map (--concurrent).
+// Run as: bench/range_map_bench [allocations]
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+using std::string;
+using std::vector;
+
+#include "main.h"
+
+#define CHUNK_SIZE (4<<20)
+
+struct allocation
+{
+	intptr_t start;
+	size_t size;
+	const string* owner;
+	owner_id id;
+};
+
+static double now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	return ts.tv_sec+ts.tv_nsec*1e-9;
+}
+
+// Allocation sizes are roughly log-uniform between 16 bytes and 64KiB, with
+// a few page allocations mixed in; addresses are handed out bump-pointer
+// style from 4MiB chunks, like jemalloc does for fresh memory.
+static vector<allocation> make_trace(size_t n,const vector<string>& owners,intptr_t base=0x7f0000000000,unsigned seed=42)
+{
+	std::mt19937_64 rng(seed);
+	vector<allocation> trace;
+	intptr_t chunk=base,next=chunk;
+	for (size_t i=0;i<n;i++)
+	{
+		size_t size=(rng()%20==0) ? ((rng()%16)+1)*4096 : (size_t)16<<(rng()%13);
+		size=(size+15)&~(size_t)15;
+		if (next+size>chunk+CHUNK_SIZE)
+		{
+			chunk+=CHUNK_SIZE;
+			next=chunk;
+		}
+		size_t owner=rng()%owners.size();
+		trace.push_back({next,size,&owners[owner],(owner_id)owner+1});
+		next+=size;
+	}
+	return trace;
+}
+
+static string label(const allocation& a,string*) { return *a.owner; }
+static memory_owner label(const allocation& a,memory_owner*) { return {a.id,MEMORY_POOL}; }
+static string heap_label(string*) { return "JEMALLOC_HEAP"; }
+static memory_owner heap_label(memory_owner*) { return {0,MEMORY_HEAP}; }
+
+template<typename Map,typename Value> static void run(const char* name,const vector<allocation>& trace,const vector<intptr_t>& queries)
+{
+	size_t heap_before=mallinfo2().uordblks;
+	Map map;
+
+	double start=now();
+	intptr_t mapped=0;
+	for (auto& a : trace)
+	{
+		// wrapped_mmap registers new chunks as they are needed
+		while (a.start+(intptr_t)a.size>mapped)
+		{
+			if (!mapped) mapped=a.start;
+			map.erase(mapped,mapped+CHUNK_SIZE);
+			map.insert(mapped,mapped+CHUNK_SIZE,heap_label((Value*)NULL));
+			mapped+=CHUNK_SIZE;
+		}
+		// register_memory
+		map.erase(a.start,a.start+a.size);
+		map.insert(a.start,a.start+a.size,label(a,(Value*)NULL));
+	}
+	double registered=now();
+	size_t footprint=mallinfo2().uordblks-heap_before;
+
+	uintptr_t sink=0;
+	for (auto q : queries)
+	{
+		// lookup_memory
+		auto range=map.find(q);
+		if (std::get<2>(range)) sink+=std::get<1>(range)-std::get<0>(range);
+	}
+	double looked_up=now();
+
+	printf("%-20s %8zu ranges %8.1f ns/register %8.1f ns/lookup %6.1f bytes/range (%lx)\n",name,map.size(),
+		(registered-start)*1e9/trace.size(),(looked_up-registered)*1e9/queries.size(),
+		(double)footprint/map.size(),(unsigned long)(sink&0xf));
+}
+
+struct locked_flat_map
+{
+	std::mutex lock;
+	flat_range_map<intptr_t,memory_owner> map;
+
+	void insert(intptr_t l,intptr_t r,memory_owner o)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		map.erase(l,r);
+		map.insert(l,r,o);
+	}
+
+	bool find(intptr_t p)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		return map.lookup(p);
+	}
+};
+
+struct sharded_map
+{
+	void insert(intptr_t l,intptr_t r,memory_owner o)
+	{
+		register_memory({(void*)l,(size_t)(r-l),o.owner,o.kind});
+	}
+
+	bool find(intptr_t p)
+	{
+		return lookup_memory((void*)p).start;
+	}
+};
+
+static std::atomic<uintptr_t> g_sink(0);
+
+// Every thread registers its own trace, looking up four random addresses in
+// its last 1024 allocations after each one. Returns the wall time.
+template<typename Map> static double run_threads(Map& map,const vector<vector<allocation>>& traces)
+{
+	double start=now();
+	vector<std::thread> workers;
+	for (size_t t=0;t<traces.size();t++)
+	{
+		workers.emplace_back([&map,&traces,t]()
+		{
+			auto& trace=traces[t];
+			std::mt19937_64 rng(t);
+			intptr_t mapped=0;
+			uintptr_t sink=0;
+			for (size_t i=0;i<trace.size();i++)
+			{
+				auto& a=trace[i];
+				while (a.start+(intptr_t)a.size>mapped)
+				{
+					if (!mapped) mapped=a.start;
+					map.insert(mapped,mapped+CHUNK_SIZE,{0,MEMORY_HEAP});
+					mapped+=CHUNK_SIZE;
+				}
+				map.insert(a.start,a.start+a.size,{a.id,MEMORY_POOL});
+				for (int k=0;k<4;k++)
+				{
+					auto& b=trace[i-rng()%std::min<size_t>(i+1,1024)];
+					sink+=map.find(b.start+rng()%b.size);
+				}
+			}
+			g_sink+=sink;
+		});
+	}
+	for (auto& w : workers) w.join();
+	return now()-start;
+}
+
+static void report_threads(const char* name,size_t threads,size_t n,double elapsed)
+{
+	double ops=(double)threads*n*5; // a registration and four lookups
+	printf("%-20s %zu threads %8.1f ns/op per thread %8.2f Mops/s total\n",name,threads,elapsed*1e9*threads/ops,ops/elapsed/1e6);
+}
+
+int main(int argc,char** argv)
+{
+	size_t n=argc>1 ? strtoul(argv[1],NULL,0) : 20000;
+
+	vector<string> owners;
+	for (int i=0;i<40;i++) owners.push_back("Driver"+std::to_string(i)+".efi::AllocatePool");
+	vector<allocation> trace=make_trace(n,owners);
+
+	// CopyMem/SetMem targets, spread over all allocations
+	std::mt19937_64 rng(7);
+	vector<intptr_t> queries;
+	for (size_t i=0;i<4000000;i++)
+	{
+		auto& a=trace[rng()%trace.size()];
+		queries.push_back(a.start+rng()%a.size);
+	}
+
+	run<range_map<intptr_t,string>,string>("range_map",trace,queries);
+	run<flat_range_map<intptr_t,string>,string>("flat_range_map",trace,queries);
+	run<range_map<intptr_t,memory_owner>,memory_owner>("range_map (id)",trace,queries);
+	run<flat_range_map<intptr_t,memory_owner>,memory_owner>("flat_range_map (id)",trace,queries);
+
+	// Threads allocate in separate parts of the address space, like images
+	// in their own heap chunks. Each run uses fresh addresses, and the
+	// sharded map is emptied again afterwards.
+	set_concurrent_memory_map(true);
+	intptr_t base=0x100000000000;
+	for (size_t threads=1;threads<=8;threads*=2)
+	{
+		vector<vector<allocation>> traces;
+		for (size_t t=0;t<threads;t++) traces.push_back(make_trace(n,owners,base+((intptr_t)t<<36),t+1));
+		base+=(intptr_t)1<<40;
+
+		locked_flat_map flat;
+		report_threads("flat_range_map+mutex",threads,n,run_threads(flat,traces));
+		sharded_map sharded;
+		report_threads("sharded",threads,n,run_threads(sharded,traces));
+		for (auto& trace : traces)
+		{
+			intptr_t l=trace.front().start&~(intptr_t)(CHUNK_SIZE-1);
+			unregister_memory((void*)l,trace.back().start+trace.back().size+CHUNK_SIZE-l);
+		}
+	}
+
+	return 0;
+}
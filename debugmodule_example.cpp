@@ -28,7 +28,9 @@ using vast::directory;
 #include "main.h"
 #include "debugmodule.h"
 
-#include "efi_guid.c"
+extern "C" {
+#include "efi_guid.h"
+}
 
 typedef struct _EFI_ACPI_SUPPORT_PROTOCOL {
 	void* GetAcpiTable;
@@ -0,0 +1,258 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+#include "main.h"
+#include "depgraph.h"
+
+// Binary format, all integers little-endian:
+//   char     magic[8]          "EPRDEPG1"
+//   uint32_t n_images
+//   uint32_t n_protocols
+//   n_images times:    uint16_t length, char name[length]
+//   n_protocols times: EFI_GUID guid, uint32_t n_producers, uint32_t n_consumers,
+//                      uint32_t image_index[n_producers+n_consumers]
+static const char g_depgraph_magic[8]={'E','P','R','D','E','P','G','1'};
+
+struct protocol_edges
+{
+	vector<uint32_t> producers;
+	vector<uint32_t> consumers;
+};
+
+struct depgraph
+{
+	vector<string> images;
+	unordered_map<string,uint32_t> image_index;
+	guid_table<protocol_edges> protocols;
+
+	uint32_t intern(const char* id)
+	{
+		auto it=image_index.find(id);
+		if (it!=image_index.end()) return it->second;
+		images.emplace_back(id);
+		return image_index[id]=images.size()-1;
+	}
+};
+
+static bool g_depgraph_enabled=false;
+static depgraph g_depgraph;
+
+static void add_edge(vector<uint32_t>& v,uint32_t image)
+{
+	if (std::find(v.begin(),v.end(),image)==v.end()) v.push_back(image);
+}
+
+void depgraph_enable()
+{
+	g_depgraph_enabled=true;
+}
+
+void depgraph_produce(void* caller,EFI_GUID* guid)
+{
+	if (!g_depgraph_enabled) return;
+	const char* id=find_pe_caller_id(caller);
+	if (!id) return;
+	add_edge(g_depgraph.protocols[*guid].producers,g_depgraph.intern(id));
+}
+
+void depgraph_consume(void* caller,EFI_GUID* guid)
+{
+	if (!g_depgraph_enabled) return;
+	const char* id=find_pe_caller_id(caller);
+	if (!id) return;
+	add_edge(g_depgraph.protocols[*guid].consumers,g_depgraph.intern(id));
+}
+
+bool depgraph_export(const char* filename)
+{
+	FILE* fp=fopen(filename,"wb");
+	if (!fp)
+	{
+		fprintf(stderr,"Unable to write dependency graph %s\n",filename);
+		return false;
+	}
+	uint32_t counts[2]={(uint32_t)g_depgraph.images.size(),(uint32_t)g_depgraph.protocols.size()};
+	fwrite(g_depgraph_magic,sizeof(g_depgraph_magic),1,fp);
+	fwrite(counts,sizeof(counts),1,fp);
+	for (auto& image : g_depgraph.images)
+	{
+		uint16_t len=image.size();
+		fwrite(&len,sizeof(len),1,fp);
+		fwrite(image.data(),len,1,fp);
+	}
+	for (auto& protocol : g_depgraph.protocols)
+	{
+		auto& edges=protocol.value();
+		uint32_t n[2]={(uint32_t)edges.producers.size(),(uint32_t)edges.consumers.size()};
+		fwrite(&protocol.key(),sizeof(EFI_GUID),1,fp);
+		fwrite(n,sizeof(n),1,fp);
+		fwrite(edges.producers.data(),sizeof(uint32_t),n[0],fp);
+		fwrite(edges.consumers.data(),sizeof(uint32_t),n[1],fp);
+	}
+	bool ok=!ferror(fp);
+	fclose(fp);
+	return ok;
+}
+
+bool depgraph_export_dot(const char* filename)
+{
+	FILE* fp=fopen(filename,"w");
+	if (!fp)
+	{
+		fprintf(stderr,"Unable to write dependency graph %s\n",filename);
+		return false;
+	}
+	fprintf(fp,"digraph protocols {\n");
+	for (size_t i=0;i<g_depgraph.images.size();i++)
+		fprintf(fp,"\ti%zu [shape=box,label=\"%s\"];\n",i,g_depgraph.images[i].c_str());
+	size_t p=0;
+	for (auto& protocol : g_depgraph.protocols)
+	{
+		auto& edges=protocol.value();
+		char name[64];
+		// protocols nobody installed were served by a dummy interface
+		fprintf(fp,"\tp%zu [label=\"%s\"%s];\n",p,guid_string_r((EFI_GUID*)&protocol.key(),name,sizeof(name)),edges.producers.empty() ? ",style=dashed,color=red" : "");
+		for (auto image : edges.producers)
+			fprintf(fp,"\ti%u -> p%zu;\n",image,p);
+		for (auto image : edges.consumers)
+			fprintf(fp,"\tp%zu -> i%u;\n",p,image);
+		p++;
+	}
+	fprintf(fp,"}\n");
+	bool ok=!ferror(fp);
+	fclose(fp);
+	return ok;
+}
+
+static bool depgraph_load(const char* filename,depgraph& graph)
+{
+	FILE* fp=fopen(filename,"rb");
+	if (!fp) return false;
+	// edge counts are checked against what is left of the file, so that a
+	// corrupt one can't make us allocate gigabytes
+	fseek(fp,0,SEEK_END);
+	long file_size=ftell(fp);
+	rewind(fp);
+	char magic[8];
+	uint32_t counts[2];
+	bool ok=file_size>0 && 1==fread(magic,sizeof(magic),1,fp) && 0==memcmp(magic,g_depgraph_magic,sizeof(magic)) && 1==fread(counts,sizeof(counts),1,fp);
+	string name;
+	for (uint32_t i=0;ok && i<counts[0];i++)
+	{
+		uint16_t len;
+		ok=1==fread(&len,sizeof(len),1,fp);
+		name.resize(len);
+		ok=ok && (len==0 || 1==fread(&name[0],len,1,fp));
+		if (ok) graph.intern(name.c_str());
+	}
+	for (uint32_t i=0;ok && i<counts[1];i++)
+	{
+		EFI_GUID guid;
+		uint32_t n[2];
+		ok=1==fread(&guid,sizeof(guid),1,fp) && 1==fread(n,sizeof(n),1,fp);
+		if (!ok || ((uint64_t)n[0]+n[1])*sizeof(uint32_t)>(uint64_t)(file_size-ftell(fp)))
+		{
+			ok=false;
+			break;
+		}
+		auto& edges=graph.protocols[guid];
+		edges.producers.resize(n[0]);
+		edges.consumers.resize(n[1]);
+		ok=n[0]==fread(edges.producers.data(),sizeof(uint32_t),n[0],fp) && n[1]==fread(edges.consumers.data(),sizeof(uint32_t),n[1],fp);
+	}
+	fclose(fp);
+	return ok;
+}
+
+bool depgraph_dispatch_order(const char* filename,vector<const char*>& images)
+{
+	depgraph graph;
+	if (!depgraph_load(filename,graph))
+	{
+		fprintf(stderr,"Unable to read dependency graph %s\n",filename);
+		return false;
+	}
+
+	// map graph image indices to positions in images
+	vector<int> position(graph.images.size(),-1);
+	for (size_t i=0;i<images.size();i++)
+	{
+		const char* base=strrchr(images[i],'/');
+		auto it=graph.image_index.find(base ? base+1 : images[i]);
+		if (it!=graph.image_index.end()) position[it->second]=i;
+	}
+
+	vector<vector<size_t>> successors(images.size());
+	vector<size_t> indegree(images.size(),0);
+	for (auto& protocol : graph.protocols)
+	{
+		for (auto producer : protocol.value().producers)
+		{
+			for (auto consumer : protocol.value().consumers)
+			{
+				if (producer>=position.size() || consumer>=position.size()) continue;
+				int from=position[producer],to=position[consumer];
+				if (from<0 || to<0 || from==to) continue;
+				successors[from].push_back(to);
+				indegree[to]++;
+			}
+		}
+	}
+
+	// Kahn's algorithm, always picking the earliest ready image so that the
+	// command-line order decides between independent images.
+	vector<const char*> order;
+	vector<bool> done(images.size(),false);
+	while (order.size()<images.size())
+	{
+		size_t next=images.size();
+		for (size_t i=0;i<images.size();i++)
+		{
+			if (!done[i] && indegree[i]==0)
+			{
+				next=i;
+				break;
+			}
+		}
+		if (next==images.size())
+		{
+			// cycle: run the earliest remaining image anyway
+			for (next=0;done[next];next++);
+			fprintf(stdout,"Dependency cycle, dispatching %s early\n",images[next]);
+		}
+		done[next]=true;
+		order.push_back(images[next]);
+		for (auto s : successors[next])
+			if (indegree[s]) indegree[s]--;
+	}
+	images.swap(order);
+	return true;
+}
@@ -0,0 +1,40 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef DEPGRAPH_H
+#define DEPGRAPH_H
+
+#include <efi.h>
+#include <vector>
+
+// Protocol producer/consumer graph between images, keyed by the image ID that
+// find_pe_caller_id returns. Nothing is recorded unless recording was enabled.
+void depgraph_enable();
+void depgraph_produce(void* caller,EFI_GUID* guid); // caller: return address of the stub
+void depgraph_consume(void* caller,EFI_GUID* guid);
+
+bool depgraph_export(const char* filename); // compact binary, see depgraph.cpp
+bool depgraph_export_dot(const char* filename);
+
+// Orders images so that producers run before their consumers according to a
+// graph exported by an earlier run. Images the graph doesn't know keep their
+// relative position; cycles are broken in the given order.
+bool depgraph_dispatch_order(const char* filename,std::vector<const char*>& images);
+
+#endif //DEPGRAPH_H
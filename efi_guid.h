@@ -0,0 +1,872 @@
+/**
+ * The data in this file have been collected and assembled from publicly-
+ * available sources.
+ * 
+ * http://www.tianocore.org/edk2/
+ * http://wiki.phoenix.com/
+ */
+
+#ifndef EFI_GUID_H
+#define EFI_GUID_H
+
+typedef struct {
+	EFI_GUID* guid;
+	const char* name;
+} guid_name;
+
+extern guid_name g_guid_names[];
+
+extern EFI_GUID gAppPkgTokenSpaceGuid;
+extern EFI_GUID gArmJunoTokenSpaceGuid;
+extern EFI_GUID gArmTokenSpaceGuid;
+extern EFI_GUID gArmMpCoreInfoGuid;
+extern EFI_GUID gArmMpCoreInfoPpiGuid;
+extern EFI_GUID gVirtualUncachedPagesProtocolGuid;
+extern EFI_GUID gArmPlatformTokenSpaceGuid;
+extern EFI_GUID gVariableRuntimeDxeFileGuid;
+extern EFI_GUID gArmGlobalVariableGuid;
+extern EFI_GUID gArmBootMonFsFileInfoGuid;
+extern EFI_GUID gArmPlatformUpdateFdtEventGuid;
+extern EFI_GUID gArmGlobalVariablePpiGuid;
+extern EFI_GUID gArmRealViewEbPkgTokenSpaceGuid;
+extern EFI_GUID gArmVExpressTokenSpaceGuid;
+extern EFI_GUID gArmVirtualizationTokenSpaceGuid;
+extern EFI_GUID gEarlyPL011BaseAddressGuid;
+extern EFI_GUID gBeagleBoardTokenSpaceGuid;
+extern EFI_GUID gEfiRuntimeCryptProtocolGuid;
+extern EFI_GUID gEfiPciExpressBaseAddressGuid;
+extern EFI_GUID gEfiAcpiDescriptionGuid;
+extern EFI_GUID gEfiFlashMapHobGuid;
+extern EFI_GUID gEfiPciOptionRomTableGuid;
+extern EFI_GUID gDuetConsoleOutConfigGuid;
+extern EFI_GUID gDxeCoreFileNameGuid;
+extern EFI_GUID gLdrMemoryDescriptorGuid;
+extern EFI_GUID gEfiSmmBaseThunkCommunicationGuid;
+extern EFI_GUID gEfiBootStateGuid;
+extern EFI_GUID gEfiEdkCompatibilityPkgTokenSpaceGuid;
+extern EFI_GUID gFrameworkBdsFrontPageFormsetGuid;
+extern EFI_GUID gEcpPeiPciCfgPpiGuid;
+extern EFI_GUID gEfiPrintProtocolGuid;
+extern EFI_GUID gEfiSmmBaseHelperReadyProtocolGuid;
+extern EFI_GUID gEmbeddedTokenSpaceGuid;
+extern EFI_GUID gFdtTableGuid;
+extern EFI_GUID gHardwareInterruptProtocolGuid;
+extern EFI_GUID gEfiDebugSupportPeriodicCallbackProtocolGuid;
+extern EFI_GUID gEfiEblAddCommandProtocolGuid;
+extern EFI_GUID gEmbeddedDeviceGuid;
+extern EFI_GUID gEmbeddedExternalDeviceProtocolGuid;
+extern EFI_GUID gEmbeddedGpioProtocolGuid;
+extern EFI_GUID gPeCoffLoaderProtocolGuid;
+extern EFI_GUID gEfiMmcHostProtocolGuid;
+extern EFI_GUID gAndroidFastbootTransportProtocolGuid;
+extern EFI_GUID gAndroidFastbootPlatformProtocolGuid;
+extern EFI_GUID gUsbDeviceProtocolGuid;
+extern EFI_GUID gEmuThunkProtocolGuid;
+extern EFI_GUID gEmuIoThunkProtocolGuid;
+extern EFI_GUID gEmuGraphicsWindowProtocolGuid;
+extern EFI_GUID gEmuThreadThunkProtocolGuid;
+extern EFI_GUID gEmuBlockIoProtocolGuid;
+extern EFI_GUID gEmuSnpProtocolGuid;
+extern EFI_GUID gEmuThunkPpiGuid;
+extern EFI_GUID gEmulatorPkgTokenSpaceGuid;
+extern EFI_GUID gEmuSystemConfigGuid;
+extern EFI_GUID gEmuVirtualDisksGuid;
+extern EFI_GUID gEmuPhysicalDisksGuid;
+extern EFI_GUID gEfiIntelFrameworkModulePkgTokenSpaceGuid;
+extern EFI_GUID gEfiDataHubStatusCodeRecordGuid;
+extern EFI_GUID gTianoCustomDecompressGuid;
+extern EFI_GUID gLzmaCustomDecompressGuid;
+extern EFI_GUID gLzmaF86CustomDecompressGuid;
+extern EFI_GUID gEfiAcpiVariableCompatiblityGuid;
+extern EFI_GUID gEfiLegacyBiosGuid;
+extern EFI_GUID gEfiLegacyDevOrderVariableGuid;
+extern EFI_GUID gEfiUpdateDataFileGuid;
+extern EFI_GUID gBlockIoVendorGuid;
+extern EFI_GUID gFrontPageFormSetGuid;
+extern EFI_GUID gBootManagerFormSetGuid;
+extern EFI_GUID gDeviceManagerFormSetGuid;
+extern EFI_GUID gDriverHealthFormSetGuid;
+extern EFI_GUID gBootMaintFormSetGuid;
+extern EFI_GUID gFileExploreFormSetGuid;
+extern EFI_GUID gBdsLibStringPackageGuid;
+extern EFI_GUID gLastEnumLangGuid;
+extern EFI_GUID gHdBootDevicePathVariablGuid;
+extern EFI_GUID gEfiVgaMiniPortProtocolGuid;
+extern EFI_GUID gEfiIsaIoProtocolGuid;
+extern EFI_GUID gEfiIsaAcpiProtocolGuid;
+extern EFI_GUID gEfiPs2PolicyProtocolGuid;
+extern EFI_GUID gEfiOEMBadgingProtocolGuid;
+extern EFI_GUID gExitPmAuthProtocolGuid;
+extern EFI_GUID gEfiCacheSubClassGuid;
+extern EFI_GUID gEfiMemorySubClassGuid;
+extern EFI_GUID gEfiMiscSubClassGuid;
+extern EFI_GUID gEfiProcessorSubClassGuid;
+extern EFI_GUID gEfiCapsuleGuid;
+extern EFI_GUID gEfiConfigFileNameGuid;
+extern EFI_GUID gEfiSmmPeiSmramMemoryReserveGuid;
+extern EFI_GUID gSmmCommunicateHeaderGuid;
+extern EFI_GUID gEfiFirmwareFileSystemGuid;
+extern EFI_GUID gEfiPeiIdeBlockIoPpiGuid;
+extern EFI_GUID gEfiPei144FloppyBlockIoPpiGuid;
+extern EFI_GUID gEfiPeiBootScriptExecuterPpiGuid;
+extern EFI_GUID gEfiPeiSecurityPpiGuid;
+extern EFI_GUID gEfiPeiSmbusPpiGuid;
+extern EFI_GUID gEfiPciCfgPpiInServiceTableGuid;
+extern EFI_GUID gEfiPeiReadOnlyVariablePpiGuid;
+extern EFI_GUID gEfiPeiSectionExtractionPpiGuid;
+extern EFI_GUID gEfiPeiFvFileLoaderPpiGuid;
+extern EFI_GUID gEfiFindFvPpiGuid;
+extern EFI_GUID gEfiPeiS3ResumePpiGuid;
+extern EFI_GUID gEfiAcpiS3SaveProtocolGuid;
+extern EFI_GUID gEfiAcpiSupportProtocolGuid;
+extern EFI_GUID gEfiBootScriptSaveProtocolGuid;
+extern EFI_GUID gEfiLegacyBiosProtocolGuid;
+extern EFI_GUID gEfiLegacyBiosPlatformProtocolGuid;
+extern EFI_GUID gEfiLegacyInterruptProtocolGuid;
+extern EFI_GUID gEfiLegacyRegionProtocolGuid;
+extern EFI_GUID gEfiLegacy8259ProtocolGuid;
+extern EFI_GUID gEfiCpuIoProtocolGuid;
+extern EFI_GUID gEfiDataHubProtocolGuid;
+extern EFI_GUID gEfiFirmwareVolumeProtocolGuid;
+extern EFI_GUID gEfiSectionExtractionProtocolGuid;
+extern EFI_GUID gEfiHiiProtocolGuid;
+extern EFI_GUID gEfiHiiCompatibilityProtocolGuid;
+extern EFI_GUID gFrameworkEfiMpServiceProtocolGuid;
+extern EFI_GUID gEfiSmmBaseProtocolGuid;
+extern EFI_GUID gEfiSmmAccessProtocolGuid;
+extern EFI_GUID gEfiSmmControlProtocolGuid;
+extern EFI_GUID gEfiSmmSwDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmSxDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmPeriodicTimerDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmUsbDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmGpiDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmStandbyButtonDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmPowerButtonDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmIchnDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmCpuIoGuid;
+extern EFI_GUID gEfiFormCallbackProtocolGuid;
+extern EFI_GUID gEfiFormBrowserProtocolGuid;
+extern EFI_GUID gEfiFormBrowserCompatibilityProtocolGuid;
+extern EFI_GUID gFramerworkEfiFirmwareVolumeBlockProtocolGuid;
+extern EFI_GUID gEfiSmmCpuSaveStateProtocolGuid;
+extern EFI_GUID gIntelFspPkgTokenSpaceGuid;
+extern EFI_GUID gFspHeaderFileGuid;
+extern EFI_GUID gFspBootLoaderTemporaryMemoryGuid;
+extern EFI_GUID gFspReservedMemoryResourceHobGuid;
+extern EFI_GUID gFspNonVolatileStorageHobGuid;
+extern EFI_GUID gFspReservedMemoryResourceHobTsegGuid;
+extern EFI_GUID gFspReservedMemoryResourceHobGfxGuid;
+extern EFI_GUID gFspReservedMemoryResourceHobMiscGuid;
+extern EFI_GUID gFspWrapperTokenSpaceGuid;
+extern EFI_GUID gFspInitDonePpiGuid;
+extern EFI_GUID gTopOfTemporaryRamPpiGuid;
+extern EFI_GUID gEfiMdeModulePkgTokenSpaceGuid;
+extern EFI_GUID gPcdDataBaseHobGuid;
+extern EFI_GUID gPcdDataBaseSignatureGuid;
+extern EFI_GUID gEfiIfrTianoGuid;
+extern EFI_GUID gEfiIfrFrameworkGuid;
+extern EFI_GUID gEfiSystemNvDataFvGuid;
+extern EFI_GUID gEdkiiWorkingBlockSignatureGuid;
+extern EFI_GUID gEdkiiFaultTolerantWriteGuid;
+extern EFI_GUID gEfiConsoleOutDeviceGuid;
+extern EFI_GUID gEfiConsoleInDeviceGuid;
+extern EFI_GUID gEfiMemoryTypeInformationGuid;
+extern EFI_GUID gEfiCapsuleVendorGuid;
+extern EFI_GUID gEfiStandardErrorDeviceGuid;
+extern EFI_GUID gEfiVariableGuid;
+extern EFI_GUID gEfiVariableIndexTableGuid;
+extern EFI_GUID gSmmVariableWriteGuid;
+extern EFI_GUID gPerformanceProtocolGuid;
+extern EFI_GUID gSmmPerformanceProtocolGuid;
+extern EFI_GUID gPerformanceExProtocolGuid;
+extern EFI_GUID gSmmPerformanceExProtocolGuid;
+extern EFI_GUID gEfiCrc32GuidedSectionExtractionGuid;
+extern EFI_GUID gEfiNicIp4ConfigVariableGuid;
+extern EFI_GUID gStatusCodeCallbackGuid;
+extern EFI_GUID gMemoryStatusCodeRecordGuid;
+extern EFI_GUID gEfiStatusCodeDataTypeDebugGuid;
+extern EFI_GUID gLoadFixedAddressConfigurationTableGuid;
+extern EFI_GUID gEfiGenericVariableGuid;
+extern EFI_GUID gIdleLoopEventGuid;
+extern EFI_GUID gRecoveryOnFatUsbDiskGuid;
+extern EFI_GUID gRecoveryOnFatIdeDiskGuid;
+extern EFI_GUID gRecoveryOnFatFloppyDiskGuid;
+extern EFI_GUID gRecoveryOnDataCdGuid;
+extern EFI_GUID gEfiSmmLockBoxCommunicationGuid;
+extern EFI_GUID gEfiAcpiVariableGuid;
+extern EFI_GUID gEfiAcpiS3ContextGuid;
+extern EFI_GUID gEfiBootScriptExecutorVariableGuid;
+extern EFI_GUID gEfiBootScriptExecutorContextGuid;
+extern EFI_GUID gUsbKeyboardLayoutPackageGuid;
+extern EFI_GUID gUsbKeyboardLayoutKeyGuid;
+extern EFI_GUID gHiiResourceSamleFormSetGuid;
+extern EFI_GUID gDriverSampleFormSetGuid;
+extern EFI_GUID gDriverSampleInventoryGuid;
+extern EFI_GUID gEfiIfrRefreshIdOpGuid;
+extern EFI_GUID gPlatformOverridesManagerGuid;
+extern EFI_GUID gNicIp4ConfigNvDataGuid;
+extern EFI_GUID gVlanConfigFormSetGuid;
+extern EFI_GUID gIp4IScsiConfigGuid;
+extern EFI_GUID gIScsiCHAPAuthInfoGuid;
+extern EFI_GUID gZeroGuid;
+extern EFI_GUID gMtcVendorGuid;
+extern EFI_GUID gEfiFirmwarePerformanceGuid;
+extern EFI_GUID gFirmwarePerformanceS3PointerGuid;
+extern EFI_GUID gEventExitBootServicesFailedGuid;
+extern EFI_GUID gConnectConInEventGuid;
+extern EFI_GUID gEdkiiStatusCodeDataTypeVariableGuid;
+extern EFI_GUID gEdkiiMemoryProfileGuid;
+extern EFI_GUID gEdkiiVarErrorFlagGuid;
+extern EFI_GUID gPeiAtaControllerPpiGuid;
+extern EFI_GUID gPeiUsbHostControllerPpiGuid;
+extern EFI_GUID gPeiUsb2HostControllerPpiGuid;
+extern EFI_GUID gPeiUsbControllerPpiGuid;
+extern EFI_GUID gPeiUsbIoPpiGuid;
+extern EFI_GUID gPeiCapsulePpiGuid;
+extern EFI_GUID gPeiSecPerformancePpiGuid;
+extern EFI_GUID gEfiPeiSmmCommunicationPpiGuid;
+extern EFI_GUID gPeiSmmAccessPpiGuid;
+extern EFI_GUID gPeiSmmControlPpiGuid;
+extern EFI_GUID gPeiPostScriptTablePpiGuid;
+extern EFI_GUID gPeiSerialPortPpiGuid;
+extern EFI_GUID gEfiLoadPeImageProtocolGuid;
+extern EFI_GUID gEfiPrint2ProtocolGuid;
+extern EFI_GUID gEfiGenericMemTestProtocolGuid;
+extern EFI_GUID gEfiDpcProtocolGuid;
+extern EFI_GUID gEfiFaultTolerantWriteProtocolGuid;
+extern EFI_GUID gEfiSmmFaultTolerantWriteProtocolGuid;
+extern EFI_GUID gEfiSwapAddressRangeProtocolGuid;
+extern EFI_GUID gEfiSmmSwapAddressRangeProtocolGuid;
+extern EFI_GUID gEfiSmmVariableProtocolGuid;
+extern EFI_GUID gEdkiiVariableLockProtocolGuid;
+extern EFI_GUID gEdkiiVarCheckProtocolGuid;
+extern EFI_GUID gEdkiiSmmVarCheckProtocolGuid;
+extern EFI_GUID gEfiSmmFirmwareVolumeBlockProtocolGuid;
+extern EFI_GUID gEfiDebugMaskProtocolGuid;
+extern EFI_GUID gEfiLockBoxProtocolGuid;
+extern EFI_GUID gEfiFormBrowserExProtocolGuid;
+extern EFI_GUID gEfiEbcVmTestProtocolGuid;
+extern EFI_GUID gEfiEbcSimpleDebuggerProtocolGuid;
+extern EFI_GUID gEfiBootLogoProtocolGuid;
+extern EFI_GUID gEdkiiFormDisplayEngineProtocolGuid;
+extern EFI_GUID gEdkiiFormBrowserEx2ProtocolGuid;
+extern EFI_GUID gEfiGlobalVariableGuid;
+extern EFI_GUID gEfiVT100PlusGuid;
+extern EFI_GUID gEfiVT100Guid;
+extern EFI_GUID gEfiPcAnsiGuid;
+extern EFI_GUID gEfiVTUTF8Guid;
+extern EFI_GUID gEfiUartDevicePathGuid;
+extern EFI_GUID gEfiSasDevicePathGuid;
+extern EFI_GUID gEfiPartTypeLegacyMbrGuid;
+extern EFI_GUID gEfiPartTypeSystemPartGuid;
+extern EFI_GUID gEfiPartTypeUnusedGuid;
+extern EFI_GUID gEfiDebugImageInfoTableGuid;
+extern EFI_GUID gEfiAcpiTableGuid;
+extern EFI_GUID gEfiAcpi20TableGuid;
+extern EFI_GUID gEfiAcpi10TableGuid;
+extern EFI_GUID gEfiSmbiosTableGuid;
+extern EFI_GUID gEfiMpsTableGuid;
+extern EFI_GUID gEfiSalSystemTableGuid;
+extern EFI_GUID gEfiAuthenticationChapLocalGuid;
+extern EFI_GUID gEfiAuthenticationChapRadiusGuid;
+extern EFI_GUID gEfiFileSystemVolumeLabelInfoIdGuid;
+extern EFI_GUID gEfiFileSystemInfoGuid;
+extern EFI_GUID gEfiFileInfoGuid;
+extern EFI_GUID gBootObjectAuthorizationParmsetGuid;
+extern EFI_GUID gEfiPlatformToDriverConfigurationClpGuid;
+extern EFI_GUID gEfiHiiKeyBoardLayoutGuid;
+extern EFI_GUID gEfiHashAlgorithmMD5Guid;
+extern EFI_GUID gEfiHashAlgorithmSha512Guid;
+extern EFI_GUID gEfiHashAlgorithmSha384Guid;
+extern EFI_GUID gEfiHashAlgorithmSha256Guid;
+extern EFI_GUID gEfiHashAlgorithmSha224Guid;
+extern EFI_GUID gEfiHashAlgorithmSha1Guid;
+extern EFI_GUID gEfiEventReadyToBootGuid;
+extern EFI_GUID gEfiEventMemoryMapChangeGuid;
+extern EFI_GUID gEfiEventVirtualAddressChangeGuid;
+extern EFI_GUID gEfiEventExitBootServicesGuid;
+extern EFI_GUID gEfiDebugPortVariableGuid;
+extern EFI_GUID gEfiDebugPortDevicePathGuid;
+extern EFI_GUID gEfiHiiPlatformSetupFormsetGuid;
+extern EFI_GUID gEfiHiiDriverHealthFormsetGuid;
+extern EFI_GUID gEfiHiiUserCredentialFormsetGuid;
+extern EFI_GUID gEfiHiiStandardFormGuid;
+extern EFI_GUID gEfiMemoryOverwriteControlDataGuid;
+extern EFI_GUID gEfiCertTypeRsa2048Sha256Guid;
+extern EFI_GUID gEfiEventNotificationTypeCmcGuid;
+extern EFI_GUID gEfiEventNotificationTypeCpeGuid;
+extern EFI_GUID gEfiEventNotificationTypeMceGuid;
+extern EFI_GUID gEfiEventNotificationTypePcieGuid;
+extern EFI_GUID gEfiEventNotificationTypeInitGuid;
+extern EFI_GUID gEfiEventNotificationTypeNmiGuid;
+extern EFI_GUID gEfiEventNotificationTypeBootGuid;
+extern EFI_GUID gEfiEventNotificationTypeDmarGuid;
+extern EFI_GUID gEfiProcessorGenericErrorSectionGuid;
+extern EFI_GUID gEfiProcessorSpecificErrorSectionGuid;
+extern EFI_GUID gEfiPlatformMemoryErrorSectionGuid;
+extern EFI_GUID gEfiPcieErrorSectionGuid;
+extern EFI_GUID gEfiFirmwareErrorSectionGuid;
+extern EFI_GUID gEfiPciBusErrorSectionGuid;
+extern EFI_GUID gEfiPciDevErrorSectionGuid;
+extern EFI_GUID gEfiDMArGenericErrorSectionGuid;
+extern EFI_GUID gEfiDirectedIoDMArErrorSectionGuid;
+extern EFI_GUID gEfiIommuDMArErrorSectionGuid;
+extern EFI_GUID gEfiEventUserProfileChangedGuid;
+extern EFI_GUID gEfiUserCredentialClassUnknownGuid;
+extern EFI_GUID gEfiUserCredentialClassPasswordGuid;
+extern EFI_GUID gEfiUserCredentialClassSmartCardGuid;
+extern EFI_GUID gEfiUserCredentialClassFingerprintGuid;
+extern EFI_GUID gEfiUserCredentialClassHandprintGuid;
+extern EFI_GUID gEfiUserCredentialClassSecureCardGuid;
+extern EFI_GUID gEfiUserInfoAccessSetupAdminGuid;
+extern EFI_GUID gEfiUserInfoAccessSetupNormalGuid;
+extern EFI_GUID gEfiUserInfoAccessSetupRestrictedGuid;
+extern EFI_GUID gEfiImageSecurityDatabaseGuid;
+extern EFI_GUID gEfiCertSha256Guid;
+extern EFI_GUID gEfiCertRsa2048Guid;
+extern EFI_GUID gEfiCertRsa2048Sha256Guid;
+extern EFI_GUID gEfiCertSha1Guid;
+extern EFI_GUID gEfiCertRsa2048Sha1Guid;
+extern EFI_GUID gEfiCertX509Guid;
+extern EFI_GUID gEfiKmsFormatGeneric128Guid;
+extern EFI_GUID gEfiKmsFormatGeneric160Guid;
+extern EFI_GUID gEfiKmsFormatGeneric256Guid;
+extern EFI_GUID gEfiKmsFormatGeneric512Guid;
+extern EFI_GUID gEfiKmsFormatGeneric1024Guid;
+extern EFI_GUID gEfiKmsFormatGeneric2048Guid;
+extern EFI_GUID gEfiKmsFormatGeneric3072Guid;
+extern EFI_GUID gEfiKmsFormatMd2128Guid;
+extern EFI_GUID gEfiKmsFormatMdc2128Guid;
+extern EFI_GUID gEfiKmsFormatMd4128Guid;
+extern EFI_GUID gEfiKmsFormatMdc4128Guid;
+extern EFI_GUID gEfiKmsFormatMd5128Guid;
+extern EFI_GUID gEfiKmsFormatMd5sha128Guid;
+extern EFI_GUID gEfiKmsFormatSha1160Guid;
+extern EFI_GUID gEfiKmsFormatSha256256Guid;
+extern EFI_GUID gEfiKmsFormatSha512512Guid;
+extern EFI_GUID gEfiKmsFormatAesxts128Guid;
+extern EFI_GUID gEfiKmsFormatAesxts256Guid;
+extern EFI_GUID gEfiKmsFormatAescbc128Guid;
+extern EFI_GUID gEfiKmsFormatAescbc256Guid;
+extern EFI_GUID gEfiKmsFormatRsasha11024Guid;
+extern EFI_GUID gEfiKmsFormatRsasha12048Guid;
+extern EFI_GUID gEfiKmsFormatRsasha2562048Guid;
+extern EFI_GUID gEfiKmsFormatRsasha2563072Guid;
+extern EFI_GUID gEfiCertSha224Guid;
+extern EFI_GUID gEfiCertSha384Guid;
+extern EFI_GUID gEfiCertSha512Guid;
+extern EFI_GUID gEfiCertPkcs7Guid;
+extern EFI_GUID gEfiHashAlgorithmSha1NoPadGuid;
+extern EFI_GUID gEfiHashAlgorithmSha256NoPadGuid;
+extern EFI_GUID gEfiFmpCapsuleGuid;
+extern EFI_GUID gEfiCertX509Sha256Guid;
+extern EFI_GUID gEfiCertX509Sha384Guid;
+extern EFI_GUID gEfiCertX509Sha512Guid;
+extern EFI_GUID gEfiRngAlgorithmSp80090Hash256Guid;
+extern EFI_GUID gEfiRngAlgorithmSp80090Hmac256Guid;
+extern EFI_GUID gEfiRngAlgorithmSp80090Ctr256Guid;
+extern EFI_GUID gEfiRngAlgorithmX9313DesGuid;
+extern EFI_GUID gEfiRngAlgorithmX931AesGuid;
+extern EFI_GUID gEfiAdapterInfoMediaStateGuid;
+extern EFI_GUID gEfiAdapterInfoNetworkBootGuid;
+extern EFI_GUID gEfiAdapterInfoSanMacAddressGuid;
+extern EFI_GUID gAprioriGuid;
+extern EFI_GUID gEfiFirmwareFileSystem2Guid;
+extern EFI_GUID gEfiFirmwareVolumeTopFileGuid;
+extern EFI_GUID gEfiHobMemoryAllocModuleGuid;
+extern EFI_GUID gEfiHobMemoryAllocStackGuid;
+extern EFI_GUID gEfiHobMemoryAllocBspStoreGuid;
+extern EFI_GUID gEfiEventLegacyBootGuid;
+extern EFI_GUID gEfiHobListGuid;
+extern EFI_GUID gEfiDxeServicesTableGuid;
+extern EFI_GUID gEfiMdePkgTokenSpaceGuid;
+extern EFI_GUID gEfiHardwareErrorVariableGuid;
+extern EFI_GUID gEfiEventDxeDispatchGuid;
+extern EFI_GUID gEfiDiskInfoIdeInterfaceGuid;
+extern EFI_GUID gEfiDiskInfoScsiInterfaceGuid;
+extern EFI_GUID gEfiDiskInfoUsbInterfaceGuid;
+extern EFI_GUID gEfiDiskInfoAhciInterfaceGuid;
+extern EFI_GUID gEfiStatusCodeDataTypeStringGuid;
+extern EFI_GUID gEfiStatusCodeSpecificDataGuid;
+extern EFI_GUID gEfiFirmwareFileSystem3Guid;
+extern EFI_GUID gEfiEndOfDxeEventGroupGuid;
+extern EFI_GUID gEfiFirmwareContentsSignedGuid;
+extern EFI_GUID gEfiVectorHandoffTableGuid;
+extern EFI_GUID gAdapterInfoPlatformSecurityGuid;
+extern EFI_GUID gEfiIa32X64ErrorTypeCacheCheckGuid;
+extern EFI_GUID gEfiIa32X64ErrorTypeTlbCheckGuid;
+extern EFI_GUID gEfiIa32X64ErrorTypeBusCheckGuid;
+extern EFI_GUID gEfiIa32X64ErrorTypeMsCheckGuid;
+extern EFI_GUID gEfiPeiMasterBootModePpiGuid;
+extern EFI_GUID gEfiDxeIplPpiGuid;
+extern EFI_GUID gEfiPeiMemoryDiscoveredPpiGuid;
+extern EFI_GUID gEfiPeiBootInRecoveryModePpiGuid;
+extern EFI_GUID gEfiEndOfPeiSignalPpiGuid;
+extern EFI_GUID gEfiPeiResetPpiGuid;
+extern EFI_GUID gEfiPeiStatusCodePpiGuid;
+extern EFI_GUID gEfiPeiSecurity2PpiGuid;
+extern EFI_GUID gEfiTemporaryRamSupportPpiGuid;
+extern EFI_GUID gEfiPeiCpuIoPpiInstalledGuid;
+extern EFI_GUID gEfiPciCfg2PpiGuid;
+extern EFI_GUID gEfiPeiStallPpiGuid;
+extern EFI_GUID gEfiPeiReadOnlyVariable2PpiGuid;
+extern EFI_GUID gEfiSecPlatformInformationPpiGuid;
+extern EFI_GUID gEfiPeiLoadedImagePpiGuid;
+extern EFI_GUID gEfiPeiSmbus2PpiGuid;
+extern EFI_GUID gEfiPeiFirmwareVolumeInfoPpiGuid;
+extern EFI_GUID gEfiPeiLoadFilePpiGuid;
+extern EFI_GUID gEfiPeiDecompressPpiGuid;
+extern EFI_GUID gPcdPpiGuid;
+extern EFI_GUID gGetPcdInfoPpiGuid;
+extern EFI_GUID gEfiPeiRecoveryModulePpiGuid;
+extern EFI_GUID gEfiPeiDeviceRecoveryModulePpiGuid;
+extern EFI_GUID gEfiPeiVirtualBlockIoPpiGuid;
+extern EFI_GUID gEfiPeiS3Resume2PpiGuid;
+extern EFI_GUID gEfiPeiRscHandlerPpiGuid;
+extern EFI_GUID gEfiPeiPcdPpiGuid;
+extern EFI_GUID gEfiGetPcdInfoPpiGuid;
+extern EFI_GUID gEfiTemporaryRamDonePpiGuid;
+extern EFI_GUID gEfiVectorHandoffInfoPpiGuid;
+extern EFI_GUID gEfiPeiI2cMasterPpiGuid;
+extern EFI_GUID gEfiPeiFirmwareVolumeInfo2PpiGuid;
+extern EFI_GUID gPcdProtocolGuid;
+extern EFI_GUID gGetPcdInfoProtocolGuid;
+extern EFI_GUID gEfiBdsArchProtocolGuid;
+extern EFI_GUID gEfiCpuArchProtocolGuid;
+extern EFI_GUID gEfiMetronomeArchProtocolGuid;
+extern EFI_GUID gEfiMonotonicCounterArchProtocolGuid;
+extern EFI_GUID gEfiRealTimeClockArchProtocolGuid;
+extern EFI_GUID gEfiResetArchProtocolGuid;
+extern EFI_GUID gEfiRuntimeArchProtocolGuid;
+extern EFI_GUID gEfiSecurityArchProtocolGuid;
+extern EFI_GUID gEfiSecurityPolicyProtocolGuid;
+extern EFI_GUID gEfiTimerArchProtocolGuid;
+extern EFI_GUID gEfiVariableWriteArchProtocolGuid;
+extern EFI_GUID gEfiVariableArchProtocolGuid;
+extern EFI_GUID gEfiWatchdogTimerArchProtocolGuid;
+extern EFI_GUID gEfiStatusCodeRuntimeProtocolGuid;
+extern EFI_GUID gEfiSmbusHcProtocolGuid;
+extern EFI_GUID gEfiFirmwareVolume2ProtocolGuid;
+extern EFI_GUID gEfiFirmwareVolumeBlockProtocolGuid;
+extern EFI_GUID gEfiCapsuleArchProtocolGuid;
+extern EFI_GUID gEfiMpServiceProtocolGuid;
+extern EFI_GUID gEfiPciHostBridgeResourceAllocationProtocolGuid;
+extern EFI_GUID gEfiPciPlatformProtocolGuid;
+extern EFI_GUID gEfiPciOverrideProtocolGuid;
+extern EFI_GUID gEfiPciEnumerationCompleteProtocolGuid;
+extern EFI_GUID gEfiIncompatiblePciDeviceSupportProtocolGuid;
+extern EFI_GUID gEfiPciHotPlugInitProtocolGuid;
+extern EFI_GUID gEfiPciHotPlugRequestProtocolGuid;
+extern EFI_GUID gEfiIdeControllerInitProtocolGuid;
+extern EFI_GUID gEfiDiskInfoProtocolGuid;
+extern EFI_GUID gEfiSmbiosProtocolGuid;
+extern EFI_GUID gEfiS3SaveStateProtocolGuid;
+extern EFI_GUID gEfiS3SmmSaveStateProtocolGuid;
+extern EFI_GUID gEfiRscHandlerProtocolGuid;
+extern EFI_GUID gEfiSmmRscHandlerProtocolGuid;
+extern EFI_GUID gEfiAcpiSdtProtocolGuid;
+extern EFI_GUID gEfiSioProtocolGuid;
+extern EFI_GUID gEfiSmmCpuIo2ProtocolGuid;
+extern EFI_GUID gEfiSmmBase2ProtocolGuid;
+extern EFI_GUID gEfiSmmAccess2ProtocolGuid;
+extern EFI_GUID gEfiSmmControl2ProtocolGuid;
+extern EFI_GUID gEfiSmmConfigurationProtocolGuid;
+extern EFI_GUID gEfiSmmReadyToLockProtocolGuid;
+extern EFI_GUID gEfiDxeSmmReadyToLockProtocolGuid;
+extern EFI_GUID gEfiSmmCommunicationProtocolGuid;
+extern EFI_GUID gEfiSmmStatusCodeProtocolGuid;
+extern EFI_GUID gEfiSmmCpuProtocolGuid;
+extern EFI_GUID gEfiSmmPciRootBridgeIoProtocolGuid;
+extern EFI_GUID gEfiSmmSwDispatch2ProtocolGuid;
+extern EFI_GUID gEfiSmmSxDispatch2ProtocolGuid;
+extern EFI_GUID gEfiSmmPeriodicTimerDispatch2ProtocolGuid;
+extern EFI_GUID gEfiSmmUsbDispatch2ProtocolGuid;
+extern EFI_GUID gEfiSmmGpiDispatch2ProtocolGuid;
+extern EFI_GUID gEfiSmmStandbyButtonDispatch2ProtocolGuid;
+extern EFI_GUID gEfiSmmPowerButtonDispatch2ProtocolGuid;
+extern EFI_GUID gEfiSmmIoTrapDispatch2ProtocolGuid;
+extern EFI_GUID gEfiPcdProtocolGuid;
+extern EFI_GUID gEfiFirmwareVolumeBlock2ProtocolGuid;
+extern EFI_GUID gEfiCpuIo2ProtocolGuid;
+extern EFI_GUID gEfiLegacyRegion2ProtocolGuid;
+extern EFI_GUID gEfiSalMcaInitPmiProtocolGuid;
+extern EFI_GUID gEfiExtendedSalBootServiceProtocolGuid;
+extern EFI_GUID gEfiExtendedSalBaseIoServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalStallServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalRtcServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalVariableServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalMtcServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalResetServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalStatusCodeServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalFvBlockServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalMpServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalPalServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalBaseServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalMcaServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalPciServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalCacheServicesProtocolGuid;
+extern EFI_GUID gEfiExtendedSalMcaLogServicesProtocolGuid;
+extern EFI_GUID gEfiSecurity2ArchProtocolGuid;
+extern EFI_GUID gEfiSmmEndOfDxeProtocolGuid;
+extern EFI_GUID gEfiGetPcdInfoProtocolGuid;
+extern EFI_GUID gEfiI2cMasterProtocolGuid;
+extern EFI_GUID gEfiI2cIoProtocolGuid;
+extern EFI_GUID gEfiI2cEnumerateProtocolGuid;
+extern EFI_GUID gEfiI2cHostProtocolGuid;
+extern EFI_GUID gEfiI2cBusConfigurationManagementProtocolGuid;
+extern EFI_GUID gEfiDebugPortProtocolGuid;
+extern EFI_GUID gEfiDebugSupportProtocolGuid;
+extern EFI_GUID gEfiDecompressProtocolGuid;
+extern EFI_GUID gEfiDeviceIoProtocolGuid;
+extern EFI_GUID gEfiDevicePathProtocolGuid;
+extern EFI_GUID gEfiDevicePathFromTextProtocolGuid;
+extern EFI_GUID gEfiDevicePathToTextProtocolGuid;
+extern EFI_GUID gEfiDevicePathUtilitiesProtocolGuid;
+extern EFI_GUID gEfiDriverBindingProtocolGuid;
+extern EFI_GUID gEfiPlatformDriverOverrideProtocolGuid;
+extern EFI_GUID gEfiDriverFamilyOverrideProtocolGuid;
+extern EFI_GUID gEfiBusSpecificDriverOverrideProtocolGuid;
+extern EFI_GUID gEfiDriverDiagnostics2ProtocolGuid;
+extern EFI_GUID gEfiDriverDiagnosticsProtocolGuid;
+extern EFI_GUID gEfiComponentName2ProtocolGuid;
+extern EFI_GUID gEfiComponentNameProtocolGuid;
+extern EFI_GUID gEfiDriverConfiguration2ProtocolGuid;
+extern EFI_GUID gEfiDriverConfigurationProtocolGuid;
+extern EFI_GUID gEfiPlatformToDriverConfigurationProtocolGuid;
+extern EFI_GUID gEfiDriverSupportedEfiVersionProtocolGuid;
+extern EFI_GUID gEfiSimpleTextInProtocolGuid;
+extern EFI_GUID gEfiSimpleTextInputExProtocolGuid;
+extern EFI_GUID gEfiSimpleTextOutProtocolGuid;
+extern EFI_GUID gEfiSimplePointerProtocolGuid;
+extern EFI_GUID gEfiAbsolutePointerProtocolGuid;
+extern EFI_GUID gEfiSerialIoProtocolGuid;
+extern EFI_GUID gEfiGraphicsOutputProtocolGuid;
+extern EFI_GUID gEfiEdidDiscoveredProtocolGuid;
+extern EFI_GUID gEfiEdidActiveProtocolGuid;
+extern EFI_GUID gEfiEdidOverrideProtocolGuid;
+extern EFI_GUID gEfiUgaIoProtocolGuid;
+extern EFI_GUID gEfiUgaDrawProtocolGuid;
+extern EFI_GUID gEfiLoadedImageProtocolGuid;
+extern EFI_GUID gEfiLoadedImageDevicePathProtocolGuid;
+extern EFI_GUID gEfiLoadFileProtocolGuid;
+extern EFI_GUID gEfiLoadFile2ProtocolGuid;
+extern EFI_GUID gEfiSimpleFileSystemProtocolGuid;
+extern EFI_GUID gEfiTapeIoProtocolGuid;
+extern EFI_GUID gEfiDiskIoProtocolGuid;
+extern EFI_GUID gEfiBlockIoProtocolGuid;
+extern EFI_GUID gEfiUnicodeCollationProtocolGuid;
+extern EFI_GUID gEfiUnicodeCollation2ProtocolGuid;
+extern EFI_GUID gEfiPciRootBridgeIoProtocolGuid;
+extern EFI_GUID gEfiPciIoProtocolGuid;
+extern EFI_GUID gEfiScsiIoProtocolGuid;
+extern EFI_GUID gEfiExtScsiPassThruProtocolGuid;
+extern EFI_GUID gEfiScsiPassThruProtocolGuid;
+extern EFI_GUID gEfiIScsiInitiatorNameProtocolGuid;
+extern EFI_GUID gEfiUsb2HcProtocolGuid;
+extern EFI_GUID gEfiUsbHcProtocolGuid;
+extern EFI_GUID gEfiUsbIoProtocolGuid;
+extern EFI_GUID gEfiAcpiTableProtocolGuid;
+extern EFI_GUID gEfiEbcProtocolGuid;
+extern EFI_GUID gEfiSimpleNetworkProtocolGuid;
+extern EFI_GUID gEfiNetworkInterfaceIdentifierProtocolGuid;
+extern EFI_GUID gEfiPxeBaseCodeCallbackProtocolGuid;
+extern EFI_GUID gEfiPxeBaseCodeProtocolGuid;
+extern EFI_GUID gEfiBisProtocolGuid;
+extern EFI_GUID gEfiManagedNetworkServiceBindingProtocolGuid;
+extern EFI_GUID gEfiManagedNetworkProtocolGuid;
+extern EFI_GUID gEfiArpServiceBindingProtocolGuid;
+extern EFI_GUID gEfiArpProtocolGuid;
+extern EFI_GUID gEfiDhcp4ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiDhcp4ProtocolGuid;
+extern EFI_GUID gEfiTcp4ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiTcp4ProtocolGuid;
+extern EFI_GUID gEfiIp4ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiIp4ProtocolGuid;
+extern EFI_GUID gEfiIp4ConfigProtocolGuid;
+extern EFI_GUID gEfiUdp4ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiUdp4ProtocolGuid;
+extern EFI_GUID gEfiMtftp4ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiMtftp4ProtocolGuid;
+extern EFI_GUID gEfiAuthenticationInfoProtocolGuid;
+extern EFI_GUID gEfiHashServiceBindingProtocolGuid;
+extern EFI_GUID gEfiHashProtocolGuid;
+extern EFI_GUID gEfiTcgProtocolGuid;
+extern EFI_GUID gEfiTrEEProtocolGuid;
+extern EFI_GUID gEfiFormBrowser2ProtocolGuid;
+extern EFI_GUID gEfiHiiStringProtocolGuid;
+extern EFI_GUID gEfiHiiImageProtocolGuid;
+extern EFI_GUID gEfiHiiConfigRoutingProtocolGuid;
+extern EFI_GUID gEfiHiiDatabaseProtocolGuid;
+extern EFI_GUID gEfiHiiFontProtocolGuid;
+extern EFI_GUID gEfiHiiConfigAccessProtocolGuid;
+extern EFI_GUID gEfiHiiPackageListProtocolGuid;
+extern EFI_GUID gEfiIp6ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiIp6ProtocolGuid;
+extern EFI_GUID gEfiIp6ConfigProtocolGuid;
+extern EFI_GUID gEfiMtftp6ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiMtftp6ProtocolGuid;
+extern EFI_GUID gEfiDhcp6ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiDhcp6ProtocolGuid;
+extern EFI_GUID gEfiUdp6ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiUdp6ProtocolGuid;
+extern EFI_GUID gEfiTcp6ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiTcp6ProtocolGuid;
+extern EFI_GUID gEfiVlanConfigProtocolGuid;
+extern EFI_GUID gEfiEapProtocolGuid;
+extern EFI_GUID gEfiEapManagementProtocolGuid;
+extern EFI_GUID gEfiFtp4ServiceBindingProtocolGuid;
+extern EFI_GUID gEfiFtp4ProtocolGuid;
+extern EFI_GUID gEfiIpSecConfigProtocolGuid;
+extern EFI_GUID gEfiDriverHealthProtocolGuid;
+extern EFI_GUID gEfiDeferredImageLoadProtocolGuid;
+extern EFI_GUID gEfiUserCredentialProtocolGuid;
+extern EFI_GUID gEfiUserManagerProtocolGuid;
+extern EFI_GUID gEfiAtaPassThruProtocolGuid;
+extern EFI_GUID gEfiFirmwareManagementProtocolGuid;
+extern EFI_GUID gEfiIpSecProtocolGuid;
+extern EFI_GUID gEfiIpSec2ProtocolGuid;
+extern EFI_GUID gEfiKmsProtocolGuid;
+extern EFI_GUID gEfiBlockIo2ProtocolGuid;
+extern EFI_GUID gEfiStorageSecurityCommandProtocolGuid;
+extern EFI_GUID gEfiUserCredential2ProtocolGuid;
+extern EFI_GUID gEfiDiskIo2ProtocolGuid;
+extern EFI_GUID gEfiTimestampProtocolGuid;
+extern EFI_GUID gEfiRngProtocolGuid;
+extern EFI_GUID gEfiAdapterInformationProtocolGuid;
+extern EFI_GUID gEfiNetworkPkgTokenSpaceGuid;
+extern EFI_GUID gIp6ConfigNvDataGuid;
+extern EFI_GUID gIScsiConfigGuid;
+extern EFI_GUID gEfiWinNtPassThroughGuid;
+extern EFI_GUID gEfiWinNtConsoleGuid;
+extern EFI_GUID gEfiWinNtUgaGuid;
+extern EFI_GUID gEfiWinNtGopGuid;
+extern EFI_GUID gEfiWinNtSerialPortGuid;
+extern EFI_GUID gEfiWinNtFileSystemGuid;
+extern EFI_GUID gEfiWinNtPhysicalDisksGuid;
+extern EFI_GUID gEfiWinNtVirtualDisksGuid;
+extern EFI_GUID gEfiNt32PkgTokenSpaceGuid;
+extern EFI_GUID gEfiWinNtSystemConfigGuid;
+extern EFI_GUID gPeiNtThunkPpiGuid;
+extern EFI_GUID gPeiNtAutoScanPpiGuid;
+extern EFI_GUID gNtPeiLoadFilePpiGuid;
+extern EFI_GUID gNtFwhPpiGuid;
+extern EFI_GUID gWinNtBusDriverGuid;
+extern EFI_GUID gEfiWinNtThunkProtocolGuid;
+extern EFI_GUID gEfiWinNtIoProtocolGuid;
+extern EFI_GUID gOmap35xxTokenSpaceGuid;
+extern EFI_GUID gOptionRomPkgTokenSpaceGuid;
+extern EFI_GUID gUefiOvmfPkgTokenSpaceGuid;
+extern EFI_GUID gEfiXenInfoGuid;
+extern EFI_GUID gOvmfPlatformConfigGuid;
+extern EFI_GUID gVirtioMmioTransportGuid;
+extern EFI_GUID gVirtioDeviceProtocolGuid;
+extern EFI_GUID gBlockMmioProtocolGuid;
+extern EFI_GUID gXenBusProtocolGuid;
+extern EFI_GUID gPcAtChipsetPkgTokenSpaceGuid;
+extern EFI_GUID gPerformancePkgTokenSpaceGuid;
+extern EFI_GUID gEfiTscFrequencyGuid;
+extern EFI_GUID gAcpi10TableGuid;
+extern EFI_GUID gAcpiTableGuid;
+extern EFI_GUID gPeiCapsuleOnDataCdGuid;
+extern EFI_GUID gPeiCapsuleOnFatFloppyDiskGuid;
+extern EFI_GUID gPeiCapsuleOnFatIdeDiskGuid;
+extern EFI_GUID gPeiCapsuleOnFatUsbDiskGuid;
+extern EFI_GUID gDxeDebugportExtProtocolGuid;
+extern EFI_GUID gDxeDebugCmdProtocolGuid;
+extern EFI_GUID gDxeDebugDispatchProtocolGuid;
+extern EFI_GUID gEfiAlertStandardFormatProtocolGuid;
+extern EFI_GUID gEfiDebugportProtocolGuid;
+extern EFI_GUID gEfiMpServicesProtocolGuid;
+extern EFI_GUID gEfiPeiPeCoffLoaderGuid;
+extern EFI_GUID gEfiSimpleTextInputProtocolGuid;
+extern EFI_GUID gEfiSimpleTextOutputProtocolGuid;
+extern EFI_GUID gEfiTcgPrivateInterfaceGuid;
+extern EFI_GUID gMpsTableGuid;
+extern EFI_GUID gPdmWindowButtonGuid;
+extern EFI_GUID gPdmWindowSpinGuid;
+extern EFI_GUID gPeiCachePpiGuid;
+extern EFI_GUID gPeiDebugDispatchPpiGuid;
+extern EFI_GUID gPeiPostBootScriptTablePpiGuid;
+extern EFI_GUID gPeiSmbusPolicyPpiGuid;
+extern EFI_GUID gPhoenixDesktopMessageProtocolGuid;
+extern EFI_GUID gPhoenixDesktopWindowProtocolGuid;
+extern EFI_GUID gPhoenixGdiProtocolGuid;
+extern EFI_GUID gPhoenixSmmCoreServicesProtocolGuid;
+extern EFI_GUID gPhoenixEfiSmmSwSmiProtocolGuid;
+extern EFI_GUID gPhoenixSmmWatchdogTimerProtocolGuid;
+extern EFI_GUID gSalSystemTableGuid;
+extern EFI_GUID gSctIsaHcPpiGuid;
+extern EFI_GUID gSctIsaHcProtocolGuid;
+extern EFI_GUID gSmbiosTableGuid;
+extern EFI_GUID gPeiSpeakerInterfacePpiGuid;
+extern EFI_GUID gPeiMfgMemoryTestPpiGuid;
+extern EFI_GUID gPeiSha256HashPpiGuid;
+extern EFI_GUID gEfiPlatformBootModeGuid;
+extern EFI_GUID gEfiPlatformInfoGuid;
+extern EFI_GUID gEfiMemoryConfigDataGuid;
+extern EFI_GUID gPlatformModuleTokenSpaceGuid;
+extern EFI_GUID gEfiSerialPortTokenSpaceGuid;
+extern EFI_GUID gEfiIchTokenSpaceGuid;
+extern EFI_GUID gEfiPchTokenSpaceGuid;
+extern EFI_GUID gEfiSioVariableGuid;
+extern EFI_GUID gProcessorProducerGuid;
+extern EFI_GUID gEfiPowerOnHobGuid;
+extern EFI_GUID gEfiPlatformCpuInfoGuid;
+extern EFI_GUID gEfiBiosIdGuid;
+extern EFI_GUID gEfiBoardFeaturesGuid;
+extern EFI_GUID gItkDataVarGuid;
+extern EFI_GUID gDmiDataGuid;
+extern EFI_GUID gIdccDataHubGuid;
+extern EFI_GUID gEfiSetupVariableGuid;
+extern EFI_GUID gMfgModeVariableGuid;
+extern EFI_GUID gEfiAcpiTableStorageGuid;
+extern EFI_GUID gACPIOSFRMfgStringVariableGuid;
+extern EFI_GUID gACPIOSFRRefDataBlockVariableGuid;
+extern EFI_GUID gACPIOSFRModelStringVariableGuid;
+extern EFI_GUID gEfiPciLanInfoGuid;
+extern EFI_GUID gEfiNormalSetupGuid;
+extern EFI_GUID gFirmwareIdGuid;
+extern EFI_GUID gBmpImageGuid;
+extern EFI_GUID gOsSelectionVariableGuid;
+extern EFI_GUID gEfiActiveBiosProtocolGuid;
+extern EFI_GUID gEfiPlatformCpuProtocolGuid;
+extern EFI_GUID gDxePchPlatformPolicyProtocolGuid;
+extern EFI_GUID gEfiTpmMpDriverProtocolGuid;
+extern EFI_GUID gEfiLpcWpce791PolicyProtocolGuid;
+extern EFI_GUID gUsbPolicyGuid;
+extern EFI_GUID gEfiSpeakerInterfaceProtocolGuid;
+extern EFI_GUID gDxeVlvPlatformPolicyGuid;
+extern EFI_GUID gEfiSmbiosSlotPopulationGuid;
+extern EFI_GUID gObservableProtocolGuid;
+extern EFI_GUID gEfiCk505ClockPlatformInfoGuid;
+extern EFI_GUID gEfiLpcWpc83627PolicyProtocolGuid;
+extern EFI_GUID gEfiTcoResetProtocolGuid;
+extern EFI_GUID gEfiWatchdogTimerDriverProtocolGuid;
+extern EFI_GUID gEfiPlatformIdeInitProtocolGuid;
+extern EFI_GUID gEnhancedSpeedstepProtocolGuid;
+extern EFI_GUID gPlatformGOPPolicyGuid;
+extern EFI_GUID gEfiGopDisplayBrightnessProtocolGuid;
+extern EFI_GUID gEfiUsbKeyboardConnectGuid;
+extern EFI_GUID gEfiMmioDeviceProtocolGuid;
+extern EFI_GUID gEfiI2cBusConfigurationManagementProtocol2Guid;
+extern EFI_GUID gEfiI2cAcpiProtocolGuid;
+extern EFI_GUID gEfiI2cMasterProtocol2Guid;
+extern EFI_GUID gEfiI2cHostProtocol2Guid;
+extern EFI_GUID gEfiI2cBusProtocolGuid;
+extern EFI_GUID gEfiI2cSlaveProtocolGuid;
+extern EFI_GUID gEfiSpiAcpiProtocolGuid;
+extern EFI_GUID gEfiSpiHostProtocolGuid;
+extern EFI_GUID gEfiSpiBusProtocolGuid;
+extern EFI_GUID gLpssDummyProtocolGuid;
+extern EFI_GUID gEfiSpiProtocolGuid;
+extern EFI_GUID gEfiGpioOperationProtocolGuid;
+extern EFI_GUID gEfiEsrtOperationProtocolGuid;
+extern EFI_GUID gEfiFwDisplayCapsuleGuid;
+extern EFI_GUID gEfiFirmwareClassGuid;
+extern EFI_GUID gEfiDFUVerGuid;
+extern EFI_GUID gEfiEsrtTableGuid;
+extern EFI_GUID gEfiCapsuleCrashLogVarGuid;
+extern EFI_GUID gEfiCapsuleCrashGuid;
+extern EFI_GUID gEfiSecurityPkgTokenSpaceGuid;
+extern EFI_GUID gEfiAuthenticatedVariableGuid;
+extern EFI_GUID gEfiSecureBootEnableDisableGuid;
+extern EFI_GUID gEfiCustomModeEnableGuid;
+extern EFI_GUID gEfiVendorKeysNvGuid;
+extern EFI_GUID gEfiCertDbGuid;
+extern EFI_GUID gTcgEventEntryHobGuid;
+extern EFI_GUID gTpmErrorHobGuid;
+extern EFI_GUID gMeasuredFvHobGuid;
+extern EFI_GUID gEfiPhysicalPresenceGuid;
+extern EFI_GUID gPwdCredentialProviderGuid;
+extern EFI_GUID gUsbCredentialProviderGuid;
+extern EFI_GUID gUserIdentifyManagerGuid;
+extern EFI_GUID gUserProfileManagerGuid;
+extern EFI_GUID gTcgConfigFormSetGuid;
+extern EFI_GUID gSecureBootConfigFormSetGuid;
+extern EFI_GUID gEfiTrEEPhysicalPresenceGuid;
+extern EFI_GUID gEfiTpmDeviceInstanceNoneGuid;
+extern EFI_GUID gEfiTpmDeviceInstanceTpm12Guid;
+extern EFI_GUID gEfiTpmDeviceInstanceTpm20DtpmGuid;
+extern EFI_GUID gEfiTpmDeviceSelectedGuid;
+extern EFI_GUID gTrEEConfigFormSetGuid;
+extern EFI_GUID gPeiLockPhysicalPresencePpiGuid;
+extern EFI_GUID gPeiTpmInitializedPpiGuid;
+extern EFI_GUID gPeiTpmInitializationDonePpiGuid;
+extern EFI_GUID gEfiPeiFirmwareVolumeInfoMeasurementExcludedPpiGuid;
+extern EFI_GUID gEfiShellEnvironment2ExtGuid;
+extern EFI_GUID gEfiShellPkgTokenSpaceGuid;
+extern EFI_GUID gShellVariableGuid;
+extern EFI_GUID gShellMapGuid;
+extern EFI_GUID gShellAliasGuid;
+extern EFI_GUID gHandleParsingHiiGuid;
+extern EFI_GUID gShellDebug1HiiGuid;
+extern EFI_GUID gShellDriver1HiiGuid;
+extern EFI_GUID gShellInstall1HiiGuid;
+extern EFI_GUID gShellLevel1HiiGuid;
+extern EFI_GUID gShellLevel2HiiGuid;
+extern EFI_GUID gShellLevel3HiiGuid;
+extern EFI_GUID gShellNetwork1HiiGuid;
+extern EFI_GUID gShellBcfgHiiGuid;
+extern EFI_GUID gEfiShellProtocolGuid;
+extern EFI_GUID gEfiShellParametersProtocolGuid;
+extern EFI_GUID gEfiShellEnvironment2Guid;
+extern EFI_GUID gEfiShellInterfaceGuid;
+extern EFI_GUID gEfiShellDynamicCommandProtocolGuid;
+extern EFI_GUID gEfiDebugAgentGuid;
+extern EFI_GUID gEfiSourceLevelDebugPkgTokenSpaceGuid;
+extern EFI_GUID gStdLibTokenSpaceGuid;
+extern EFI_GUID gEfiSocketProtocolGuid;
+extern EFI_GUID gEfiSocketServiceBindingProtocolGuid;
+extern EFI_GUID gUefiCpuPkgTokenSpaceGuid;
+extern EFI_GUID gVlvPolicyPpiGuid;
+extern EFI_GUID gVlvMmioPolicyPpiGuid;
+extern EFI_GUID gSeCfTPMPpiGuid;
+extern EFI_GUID gPchUsbPolicyPpiGuid;
+extern EFI_GUID gPchInitPpiGuid;
+extern EFI_GUID gPchPlatformPolicyPpiGuid;
+extern EFI_GUID gPeiSpiPpiGuid;
+extern EFI_GUID gVlvPeiInitPpiGuid;
+extern EFI_GUID gSeCUmaPpiGuid;
+extern EFI_GUID gPeiSeCPlatformPolicyPpiGuid;
+extern EFI_GUID gPeiHeciPpiGuid;
+extern EFI_GUID gPeiSdhcPpiGuid;
+extern EFI_GUID gPeiBlockIoPpiGuid;
+extern EFI_GUID gSeCfTPMPolicyPpiGuid;
+extern EFI_GUID gPchPeiInitPpiGuid;
+extern EFI_GUID gEfiGlobalNvsAreaProtocolGuid;
+extern EFI_GUID gPpmPlatformPolicyProtocolGuid;
+extern EFI_GUID gMemInfoProtocolGuid;
+extern EFI_GUID gEfiSdHostIoProtocolGuid;
+extern EFI_GUID gEfiSmmSpiProtocolGuid;
+extern EFI_GUID gEfiSmmIchnDispatchExProtocolGuid;
+extern EFI_GUID gEfiPchS3SupportProtocolGuid;
+extern EFI_GUID gPchResetProtocolGuid;
+extern EFI_GUID gPchResetCallbackProtocolGuid;
+extern EFI_GUID gEfiPchInfoProtocolGuid;
+extern EFI_GUID gEfiPchExtendedResetProtocolGuid;
+extern EFI_GUID gDxeIchPlatformPolicyProtocolGuid;
+extern EFI_GUID gEfiIchInfoProtocolGuid;
+extern EFI_GUID gEfiSmmIoTrapDispatchProtocolGuid;
+extern EFI_GUID gEfiSmmSmbusProtocolGuid;
+extern EFI_GUID gIgdOpRegionProtocolGuid;
+extern EFI_GUID gEfiHeciProtocolGuid;
+extern EFI_GUID gPlatformSeCHookProtocolGuid;
+extern EFI_GUID gEfiSeCRcInfoProtocolGuid;
+extern EFI_GUID gEfiTdtProtocolGuid;
+extern EFI_GUID gDxePlatformSeCPolicyGuid;
+extern EFI_GUID gEfiEmmcCardInfoProtocolGuid;
+extern EFI_GUID gEfiTdtOperationProtocolGuid;
+extern EFI_GUID gEfiDFUResultGuid;
+extern EFI_GUID gEfiCPTokenSpaceGuid;
+extern EFI_GUID gEfiSmbusArpMapGuid;
+extern EFI_GUID gEfiVLVTokenSpaceGuid;
+extern EFI_GUID gSataControllerDriverGuid;
+extern EFI_GUID gDxePchPolicyUpdateProtocolGuid;
+extern EFI_GUID gPowerManagementAcpiTableStorageGuid;
+extern EFI_GUID gPchInitVariableGuid;
+extern EFI_GUID gVlvRefCodePkgTokenSpaceGuid;
+extern EFI_GUID gSeCPlatformReadyToBootGuid;
+extern EFI_GUID gAmtReadyToBootGuid;
+extern EFI_GUID gEfiVlv2VariableGuid;
+
+#endif //EFI_GUID_H
@@ -20,31 +20,26 @@
 #include <execinfo.h>
 #include <string.h>
 
+#include <atomic>
 #include <list>
-#include <unordered_map>
+#include <mutex>
+#include <vector>
+using std::atomic;
 using std::list;
-using std::unordered_multimap;
+using std::vector;
 using std::pair;
 using std::make_pair;
-using std::char_traits;
-
-// Seriously, there is no default way to do this?
-template<class Iter>
-struct iter_pair_range : std::pair<Iter,Iter> {
-    iter_pair_range(std::pair<Iter,Iter> const& x)
-    : std::pair<Iter,Iter>(x)
-    {}
-    Iter begin() const {return this->first;}
-    Iter end()   const {return this->second;}
-};
-
-template<class Iter>
-inline iter_pair_range<Iter> as_range(std::pair<Iter,Iter> const& x)
-{ return iter_pair_range<Iter>(x); }
 
 #include "main.h"
 #include "stubs.h"
+#include "events.h"
+#include "memmap.h"
+#include "variables.h"
 #include "efihooks.hpp"
+#include "epoch.hpp"
+extern "C" {
+#include "efi_guid.h"
+}
 
 typedef struct _EFI_DEBUG_MASK_PROTOCOL {
 	INT64 Revision;
@@ -125,12 +120,6 @@ typedef struct {
 	VOID*                    Unload;
 } EFI_LOADED_IMAGE_PROTOCOL;
 
-typedef struct {
-	void* data;
-	UINTN data_size;
-	UINT32 attributes;
-} variable_data;
-
 EFI_SYSTEM_TABLE g_efi_system_table={};
 static SIMPLE_INPUT_INTERFACE g_efi_system_table_ConIn={};
 static SIMPLE_TEXT_OUTPUT_INTERFACE g_efi_system_table_ConOut={};
@@ -150,25 +139,15 @@ static EFI_DEVICE_PATH_PROTOCOL g_empty_efi_device_path_protocol={0x7f,0xff,{0,0
 static EFI_LOADED_IMAGE_PROTOCOL g_efi_loaded_image_protocol={};
 
 static list<GenericHook<const char*>> g_str_hooks;
-static unordered_multimap<EFI_GUID,pair<EFI_HANDLE,void*>> g_interfaces;
-static unordered_multimap<EFI_GUID,pair<CHAR16*,variable_data*>> g_variables;
+typedef guid_table<vector<pair<EFI_HANDLE,void*>>> interface_table;
 
-#include "efi_guid.c"
-
-const char* guid_string(EFI_GUID* guid)
-{
-	static char str[64];
-	for (guid_name* p=g_guid_names;p->guid;p++)
-	{
-		if (*(p->guid)==*guid)
-		{
-			snprintf(str,sizeof(str),"GUID:%s",p->name);
-			return str;
-		}
-	}
-	snprintf(str,sizeof(str),"%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x",guid->Data1,guid->Data2,guid->Data3,guid->Data4[0],guid->Data4[1],guid->Data4[2],guid->Data4[3],guid->Data4[4],guid->Data4[5],guid->Data4[6],guid->Data4[7]);
-	return str;
-}
+// In concurrent mode g_interfaces is an immutable snapshot: installs copy it,
+// publish the copy and retire the old one through epoch_retire. Otherwise it
+// is updated in place.
+static bool g_concurrent_registry=false;
+static atomic<interface_table*> g_interfaces(new interface_table);
+static std::mutex g_interfaces_lock;
+static atomic<unsigned long> g_interfaces_generation(0);
 
 static EFI_STATUS print_string(const char** str)
 {
@@ -188,7 +167,7 @@ static void backtrace_exit()
 		{
 			const memory_block& block=lookup_memory(ipbuf[i]);
 			if (block.start)
-				printf("  (%2d) %20s+0x%08lx %s\n",i,block.name.c_str(),block.offset,symbols[i]);
+				printf("  (%2d) %20s+0x%08lx %s\n",i,memory_label(block),block.offset,symbols[i]);
 			else
 				printf("  (%2d) 0x%016lx %s\n",    i,         (intptr_t)ipbuf[i]    ,symbols[i]);
 		}
@@ -244,6 +223,43 @@ void log_protocol(const char* type,EFI_GUID* guid)
 	fprintf(stdout,"%s Protocol %s\n",type,guid_string(guid));
 }
 
+static void* lookup_interface(interface_table* interfaces,EFI_GUID* guid,EFI_HANDLE handle)
+{
+	void* nullintf=NULL;
+	void* firstintf=NULL;
+	if (auto* entries=interfaces->find(*guid))
+	{
+		for (auto& elem : *entries)
+		{
+			auto& el_handle=elem.first;
+			auto& el_intf=elem.second;
+			if (el_handle==handle) return el_intf;
+			if (el_handle==NULL) nullintf=el_intf;
+			if (firstintf==NULL) firstintf=el_intf;
+		}
+	}
+	if (nullintf) return nullintf;
+	return firstintf;
+}
+
+// call with g_interfaces_lock held
+static void install_interface_locked(EFI_GUID* guid,EFI_HANDLE handle,void* interface)
+{
+	interface_table* interfaces=g_interfaces.load(std::memory_order_relaxed);
+	if (!g_concurrent_registry)
+	{
+		(*interfaces)[*guid].emplace_back(handle,interface);
+	}
+	else
+	{
+		interface_table* next=new interface_table(*interfaces);
+		(*next)[*guid].emplace_back(handle,interface);
+		g_interfaces.store(next,std::memory_order_release);
+		epoch_retire(interfaces);
+	}
+	g_interfaces_generation.fetch_add(1,std::memory_order_release);
+}
+
 void* find_protocol(EFI_GUID* guid,EFI_HANDLE handle)
 {
 /*
@@ -257,63 +273,42 @@ void* find_protocol(EFI_GUID* guid,EFI_HANDLE handle)
  *    return first(intf) if ∃ ([any] ,intf) ∈ g_interfaces[guid]
  *    return new dummy   if ∅ == g_interfaces[guid]
  */
-	void* nullintf=NULL;
-	void* firstintf=NULL;
-	for (auto& elem : as_range(g_interfaces.equal_range(*guid)))
 	{
-		auto& el_handle=elem.second.first;
-		auto& el_intf=elem.second.second;
-		if (el_handle==handle) return el_intf;
-		if (el_handle==NULL) nullintf=el_intf;
-		if (firstintf==NULL) firstintf=el_intf;
+		epoch_guard guard(g_concurrent_registry);
+		void* intf=lookup_interface(g_interfaces.load(std::memory_order_acquire),guid,handle);
+		if (intf) return intf;
 	}
-	if (nullintf) return nullintf;
-	if (firstintf) return firstintf;
-	void *intf=new DummyInterface<80>(guid,(HOOKFN_T(,GuidIndex))print_guidindex_exit);
+	std::lock_guard<std::mutex> lock(g_interfaces_lock);
+	// somebody else may have installed one in the meantime
+	void* intf=lookup_interface(g_interfaces.load(std::memory_order_relaxed),guid,handle);
+	if (intf) return intf;
+	intf=new DummyInterface<80>(guid,(HOOKFN_T(,GuidIndex))print_guidindex_exit);
 	fprintf(stdout,"  new dummy @address %016lx\n",(intptr_t)intf);
-	g_interfaces.emplace(*guid,make_pair((EFI_HANDLE)NULL,intf));
+	install_interface_locked(guid,NULL,intf);
 	return intf;
 }
 
 intptr_t count_handles(EFI_GUID* guid)
 {
-	return g_interfaces.count(*guid);
+	epoch_guard guard(g_concurrent_registry);
+	auto* entries=g_interfaces.load(std::memory_order_acquire)->find(*guid);
+	return entries ? entries->size() : 0;
 }
 
 void install_protocol(EFI_GUID* guid,EFI_HANDLE handle,void* interface)
 {
-	g_interfaces.emplace(*guid,make_pair(handle,interface));
+	std::lock_guard<std::mutex> lock(g_interfaces_lock);
+	install_interface_locked(guid,handle,interface);
 }
 
-void* get_variable(EFI_GUID* guid,CHAR16* name,UINTN* data_size,UINT32 *attributes=NULL)
+unsigned long protocol_generation()
 {
-	unsigned int name_len = char_traits<char16_t>::length((char16_t*)name);
-	for (auto& elem : as_range(g_variables.equal_range(*guid)))
-	{
-		auto& el_name=elem.second.first;
-		auto& el_var_data=elem.second.second;
-		unsigned int el_name_len = char_traits<char16_t>::length((char16_t*)el_name);
-		if (el_name_len==name_len && memcmp(el_name,name,name_len*sizeof(char16_t))==0)
-		{
-			if (data_size) *data_size=el_var_data->data_size;
-			if (attributes) *attributes=el_var_data->attributes;
-			return el_var_data->data;
-		}
-	}
-	return NULL;
+	return g_interfaces_generation.load(std::memory_order_acquire);
 }
 
-void set_variable(EFI_GUID* guid,const CHAR16* name,void* data,UINTN data_size,UINT32 attributes=EFI_VARIABLE_RUNTIME_ACCESS)
+void set_concurrent_registry(bool enable)
 {
-	unsigned int var_name_len_bytes = char_traits<char16_t>::length((char16_t*)name)*sizeof(char16_t);
-	CHAR16* var_name = (CHAR16*)malloc(var_name_len_bytes);
-	memcpy(var_name,name,var_name_len_bytes);
-	variable_data* var_data = new variable_data;
-	var_data->data=malloc(data_size);
-	memcpy(var_data->data,data,data_size);
-	var_data->data_size = data_size;
-	var_data->attributes=attributes;
-	g_variables.emplace(*guid,make_pair(var_name,var_data));
+	g_concurrent_registry=enable;
 }
 
 void char16_print(const char* prefix, CHAR16* str)
@@ -350,30 +345,30 @@ void* get_smst()
 
 void efi_hooks_init()
 {
-	DUMMYHOOK(g_efi_system_table_RuntimeServices,GetTime);
+	g_efi_system_table_RuntimeServices.GetTime=GetTime;
 	ABORTHOOK(g_efi_system_table_RuntimeServices,SetTime);
 	ABORTHOOK(g_efi_system_table_RuntimeServices,GetWakeupTime);
 	ABORTHOOK(g_efi_system_table_RuntimeServices,SetWakeupTime);
 	ABORTHOOK(g_efi_system_table_RuntimeServices,SetVirtualAddressMap);
 	ABORTHOOK(g_efi_system_table_RuntimeServices,ConvertPointer);
 	g_efi_system_table_RuntimeServices.GetVariable=GetVariable;
-	ABORTHOOK(g_efi_system_table_RuntimeServices,GetNextVariableName);
+	g_efi_system_table_RuntimeServices.GetNextVariableName=GetNextVariableName;
 	g_efi_system_table_RuntimeServices.SetVariable=SetVariable;
 	g_efi_system_table_RuntimeServices.GetNextHighMonotonicCount=GetNextHighMonotonicCount;
 	ABORTHOOK(g_efi_system_table_RuntimeServices,ResetSystem);
-	DUMMYHOOK(g_efi_system_table_BootServices,RaiseTPL);
-	DUMMYHOOK(g_efi_system_table_BootServices,RestoreTPL);
+	g_efi_system_table_BootServices.RaiseTPL=RaiseTPL;
+	g_efi_system_table_BootServices.RestoreTPL=RestoreTPL;
 	g_efi_system_table_BootServices.AllocatePages=AllocatePages;
-	ABORTHOOK(g_efi_system_table_BootServices,FreePages);
-	ABORTHOOK(g_efi_system_table_BootServices,GetMemoryMap);
+	g_efi_system_table_BootServices.FreePages=FreePages;
+	g_efi_system_table_BootServices.GetMemoryMap=GetMemoryMap;
 	g_efi_system_table_BootServices.AllocatePool=AllocatePool;
-	DUMMYHOOK(g_efi_system_table_BootServices,FreePool);
-	DUMMYHOOK(g_efi_system_table_BootServices,CreateEvent);
-	ABORTHOOK(g_efi_system_table_BootServices,SetTimer);
-	ABORTHOOK(g_efi_system_table_BootServices,WaitForEvent);
-	DUMMYHOOK(g_efi_system_table_BootServices,SignalEvent);
-	DUMMYHOOK(g_efi_system_table_BootServices,CloseEvent);
-	ABORTHOOK(g_efi_system_table_BootServices,CheckEvent);
+	g_efi_system_table_BootServices.FreePool=FreePool;
+	g_efi_system_table_BootServices.CreateEvent=CreateEvent;
+	g_efi_system_table_BootServices.SetTimer=SetTimer;
+	g_efi_system_table_BootServices.WaitForEvent=WaitForEvent;
+	g_efi_system_table_BootServices.SignalEvent=SignalEvent;
+	g_efi_system_table_BootServices.CloseEvent=CloseEvent;
+	g_efi_system_table_BootServices.CheckEvent=CheckEvent;
 	g_efi_system_table_BootServices.InstallProtocolInterface=InstallProtocolInterface;
 	ABORTHOOK(g_efi_system_table_BootServices,ReinstallProtocolInterface);
 	DUMMYHOOK(g_efi_system_table_BootServices,UninstallProtocolInterface);
@@ -387,9 +382,9 @@ void efi_hooks_init()
 	ABORTHOOK(g_efi_system_table_BootServices,StartImage);
 	ABORTHOOK(g_efi_system_table_BootServices,Exit);
 	ABORTHOOK(g_efi_system_table_BootServices,UnloadImage);
-	ABORTHOOK(g_efi_system_table_BootServices,ExitBootServices);
+	g_efi_system_table_BootServices.ExitBootServices=ExitBootServices;
 	g_efi_system_table_BootServices.GetNextMonotonicCount=GetNextMonotonicCount;
-	ABORTHOOK(g_efi_system_table_BootServices,Stall);
+	g_efi_system_table_BootServices.Stall=Stall;
 	ABORTHOOK(g_efi_system_table_BootServices,SetWatchdogTimer);
 	ABORTHOOK(g_efi_system_table_BootServices,ConnectController);
 	ABORTHOOK(g_efi_system_table_BootServices,DisconnectController);
@@ -404,7 +399,7 @@ void efi_hooks_init()
 	ABORTHOOK(g_efi_system_table_BootServices,CalculateCrc32);
 	g_efi_system_table_BootServices.CopyMem=CopyMem;
 	g_efi_system_table_BootServices.SetMem=SetMem;
-	DUMMYHOOK(g_efi_system_table_BootServices,CreateEventEx);
+	g_efi_system_table_BootServices.CreateEventEx=CreateEventEx;
 	ABORTHOOK(g_efi_system_table_ConIn,Reset);
 	ABORTHOOK(g_efi_system_table_ConIn,ReadKeyStroke);
 	ABORTHOOK(g_efi_system_table_ConIn,WaitForKey);
@@ -430,8 +425,8 @@ void efi_hooks_init()
 	g_efi_debug_mask_protocol.Revision=0x00010000;
 	DUMMYHOOK(g_efi_debug_mask_protocol,GetDebugMask);
 	DUMMYHOOK(g_efi_debug_mask_protocol,SetDebugMask);
-	g_interfaces.emplace(gEfiDebugMaskProtocolGuid,make_pair((EFI_HANDLE)NULL,&g_efi_debug_mask_protocol));
-	register_memory({&g_efi_debug_mask_protocol,sizeof(g_efi_debug_mask_protocol),"EFI_DEBUG_MASK_PROTOCOL"});
+	install_protocol(&gEfiDebugMaskProtocolGuid,NULL,&g_efi_debug_mask_protocol);
+	register_memory({&g_efi_debug_mask_protocol,sizeof(g_efi_debug_mask_protocol),intern_owner("EFI_DEBUG_MASK_PROTOCOL"),MEMORY_OTHER});
 
 	DUMMYHOOK(g_efi_smm_base_protocol,Register);
 	ABORTHOOK(g_efi_smm_base_protocol,UnRegister);
@@ -441,8 +436,8 @@ void efi_hooks_init()
 	ABORTHOOK(g_efi_smm_base_protocol,SmmAllocatePool);
 	ABORTHOOK(g_efi_smm_base_protocol,SmmFreePool);
 	g_efi_smm_base_protocol.GetSmstLocation=(void*)GetSmstLocation;
-	g_interfaces.emplace(gEfiSmmBaseProtocolGuid,make_pair((EFI_HANDLE)NULL,&g_efi_smm_base_protocol));
-	register_memory({&g_efi_smm_base_protocol,sizeof(g_efi_smm_base_protocol),"EFI_SMM_BASE_PROTOCOL"});
+	install_protocol(&gEfiSmmBaseProtocolGuid,NULL,&g_efi_smm_base_protocol);
+	register_memory({&g_efi_smm_base_protocol,sizeof(g_efi_smm_base_protocol),intern_owner("EFI_SMM_BASE_PROTOCOL"),MEMORY_OTHER});
 
 	ABORTHOOK(g_efi_smm_system_table,SmmInstallConfigurationTable);
 	g_efi_smm_system_table.SmmIo=find_protocol(&gEfiSmmCpuIoGuid,NULL);
@@ -457,8 +452,8 @@ void efi_hooks_init()
 	ABORTHOOK(g_efi_graphics_output_protocol,SetMode);
 	ABORTHOOK(g_efi_graphics_output_protocol,Blt);
 	g_efi_graphics_output_protocol.Mode=&g_efi_graphics_output_protocol_Mode;
-	g_interfaces.emplace(gEfiGraphicsOutputProtocolGuid,make_pair((EFI_HANDLE)NULL,&g_efi_graphics_output_protocol));
-	register_memory({&g_efi_graphics_output_protocol,sizeof(g_efi_graphics_output_protocol),"EFI_GRAPHICS_OUTPUT_PROTOCOL"});
+	install_protocol(&gEfiGraphicsOutputProtocolGuid,NULL,&g_efi_graphics_output_protocol);
+	register_memory({&g_efi_graphics_output_protocol,sizeof(g_efi_graphics_output_protocol),intern_owner("EFI_GRAPHICS_OUTPUT_PROTOCOL"),MEMORY_OTHER});
 
 	DUMMYHOOK(g_efi_hii_database_protocol,NewPackageList);
 	ABORTHOOK(g_efi_hii_database_protocol,RemovePackageList);
@@ -471,23 +466,23 @@ void efi_hooks_init()
 	ABORTHOOK(g_efi_hii_database_protocol,GetKeyboardLayout);
 	ABORTHOOK(g_efi_hii_database_protocol,SetKeyboardLayout);
 	ABORTHOOK(g_efi_hii_database_protocol,GetPackageListHandle);
-	g_interfaces.emplace(gEfiHiiDatabaseProtocolGuid,make_pair((EFI_HANDLE)NULL,&g_efi_hii_database_protocol));
-	register_memory({&g_efi_hii_database_protocol,sizeof(g_efi_hii_database_protocol),"EFI_HII_DATABASE_PROTOCOL"});
+	install_protocol(&gEfiHiiDatabaseProtocolGuid,NULL,&g_efi_hii_database_protocol);
+	register_memory({&g_efi_hii_database_protocol,sizeof(g_efi_hii_database_protocol),intern_owner("EFI_HII_DATABASE_PROTOCOL"),MEMORY_OTHER});
 	
 	g_efi_acpi_support_protocol.GetAcpiTable=(void*)GetAcpiTable;
 	g_efi_acpi_support_protocol.SetAcpiTable=(void*)SetAcpiTable;
 	ABORTHOOK(g_efi_acpi_support_protocol,PublishTables);
-	g_interfaces.emplace(gEfiAcpiSupportProtocolGuid,make_pair((EFI_HANDLE)NULL,&g_efi_acpi_support_protocol));
-	register_memory({&g_efi_acpi_support_protocol,sizeof(g_efi_acpi_support_protocol),"EFI_ACPI_SUPPORT_PROTOCOL"});
+	install_protocol(&gEfiAcpiSupportProtocolGuid,NULL,&g_efi_acpi_support_protocol);
+	register_memory({&g_efi_acpi_support_protocol,sizeof(g_efi_acpi_support_protocol),intern_owner("EFI_ACPI_SUPPORT_PROTOCOL"),MEMORY_OTHER});
 	
-	g_interfaces.emplace(gEfiDevicePathProtocolGuid,make_pair((EFI_HANDLE)NULL,&g_empty_efi_device_path_protocol));
-	register_memory({&g_empty_efi_device_path_protocol,sizeof(g_empty_efi_device_path_protocol),"EFI_DEVICE_PATH_PROTOCOL"});
+	install_protocol(&gEfiDevicePathProtocolGuid,NULL,&g_empty_efi_device_path_protocol);
+	register_memory({&g_empty_efi_device_path_protocol,sizeof(g_empty_efi_device_path_protocol),intern_owner("EFI_DEVICE_PATH_PROTOCOL"),MEMORY_OTHER});
 
 	g_efi_loaded_image_protocol.SystemTable=&g_efi_system_table;
 	g_efi_loaded_image_protocol.FilePath=&g_empty_efi_device_path_protocol;
 	ABORTHOOK(g_efi_loaded_image_protocol,Unload);
-	g_interfaces.emplace(gEfiLoadedImageProtocolGuid,make_pair((EFI_HANDLE)NULL,&g_efi_loaded_image_protocol));
-	register_memory({&g_efi_loaded_image_protocol,sizeof(g_efi_loaded_image_protocol),"EFI_LOADED_IMAGE_PROTOCOL"});
+	install_protocol(&gEfiLoadedImageProtocolGuid,NULL,&g_efi_loaded_image_protocol);
+	register_memory({&g_efi_loaded_image_protocol,sizeof(g_efi_loaded_image_protocol),intern_owner("EFI_LOADED_IMAGE_PROTOCOL"),MEMORY_OTHER});
 
 	g_efi_system_table.ConIn=&g_efi_system_table_ConIn;
 	g_efi_system_table_ConOut.Mode=&g_efi_system_table_ConOut_Mode;
@@ -98,7 +98,7 @@ template<int NUM> DummyInterface<NUM>::DummyInterface(EFI_GUID* pguid,HOOKFN_T(p
 		hooks.emplace_back(GuidIndex{*pguid,i},pfn);
 		pointers[i]=hooks.back().get_func();
 	}
-	register_memory({this,sizeof(pointers),std::string(guid_string(pguid))+"::PROTOCOL"});
+	register_memory({this,sizeof(pointers),intern_owner(guid_string(pguid)),MEMORY_PROTOCOL});
 }
 
 #define MAKE_GUID(g0,g1,g2,g3,g4,g5,g6,g7,g8,g9,g10)\
@@ -19,14 +19,19 @@
 
 #define DEBUG      // Do not set up SIGALRM
 
+#include <errno.h>
 #include <execinfo.h>
 #include <fcntl.h>
+#include <getopt.h>
+#include <limits.h>
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/resource.h>
+#include <sys/stat.h>
 
+#include <atomic>
 #include <utility>
 #include <vector>
 using std::vector;
@@ -36,40 +41,124 @@ using std::pair;
 #include "stubs.h"
 #include "efihooks.hpp"
 #include "debugmodule.h"
+#include "arenas.h"
+#include "depgraph.h"
+#include "events.h"
+#include "guardalloc.h"
+#include "memmap.h"
+#include "memtrace.h"
+#include "scheduler.h"
+#include "snapshot.h"
+#include "variables.h"
+#include "vclock.h"
 extern "C" {
+#include "efi_guid.h"
 #include "peloader.h"
 }
 
 using std::string;
 
-range_map<intptr_t,string> g_memory_map;
-range_map<intptr_t,pair<loadinfo,string>> g_pe_map;
+flat_range_map<intptr_t,pair<loadinfo,owner_id>> g_pe_map;
 vector<debug_module_init_fn_t> g_init_fns;
 vector<debug_module_run_fn_t> g_run_fns;
+static bool g_interleave=false;
+static const char* g_snapshot_dir=NULL;
+static unsigned g_snapshot_phase=0;
 
-void register_memory(const memory_block& block)
+// Doesn't allocate or lock, so this is fine to call from a signal handler.
+owner_id find_pe_image(void* address,void** image_base)
 {
-	g_memory_map.erase((intptr_t)block.start,block.size+(intptr_t)block.start);
-	g_memory_map.insert((intptr_t)block.start,block.size+(intptr_t)block.start,block.name);
+	auto* map=g_pe_map.lookup((intptr_t)address);
+	if (!map) return 0;
+	if (image_base) *image_base=map->first.image_base;
+	return map->second;
 }
 
-memory_block lookup_memory(void* address)
+void chain_signal(const struct sigaction& prev,int sig,siginfo_t* info,void* ctx)
 {
-	auto map=g_memory_map.find((intptr_t)address);
-	if (std::get<2>(map)) return {(void*)std::get<0>(map),(size_t)(-std::get<0>(map)+(intptr_t)address),*std::get<2>(map)};
-	return {NULL,0,string()};
+	if (prev.sa_flags&SA_SIGINFO)
+		prev.sa_sigaction(sig,info,ctx);
+	else if (prev.sa_handler!=SIG_DFL && prev.sa_handler!=SIG_IGN)
+		prev.sa_handler(sig);
+	else
+		signal(sig,SIG_DFL);
 }
 
-const char* find_pe_caller_id()
+static thread_local owner_id t_pe_image=0;
+
+pe_call_scope::pe_call_scope(owner_id image) : saved(t_pe_image)
+{
+	t_pe_image=image;
+}
+
+pe_call_scope::~pe_call_scope()
+{
+	t_pe_image=saved;
+}
+
+owner_id current_pe_image()
+{
+	return t_pe_image;
+}
+
+void set_current_pe_image(owner_id image)
 {
+	t_pe_image=image;
+}
+
+// Return addresses are looked up in a small per-thread direct-mapped cache of
+// image ranges, indexed by page. Addresses outside of any image are cached as
+// a page without an owner. Loading an image invalidates all entries.
+#define CALLER_CACHE_SIZE 64
+
+struct caller_cache_entry
+{
+	intptr_t start,end;
+	owner_id owner;
+	unsigned long generation;
+};
+
+static thread_local caller_cache_entry t_caller_cache[CALLER_CACHE_SIZE];
+static std::atomic<unsigned long> g_pe_generation(1); // bumped whenever g_pe_map changes
+
+static owner_id find_pe_return_address(void* return_address)
+{
+	intptr_t addr=(intptr_t)return_address;
+	unsigned long generation=g_pe_generation.load(std::memory_order_acquire);
+	auto& entry=t_caller_cache[(addr>>12)%CALLER_CACHE_SIZE];
+	if (entry.generation==generation && entry.start<=addr && addr<entry.end) return entry.owner;
+	auto map=g_pe_map.find(addr);
+	if (std::get<2>(map))
+		entry={std::get<0>(map),std::get<1>(map),std::get<2>(map)->second,generation};
+	else
+		entry={addr&~(intptr_t)4095,(addr|4095)+1,0,generation};
+	return entry.owner;
+}
+
+owner_id find_pe_caller(void* return_address)
+{
+	if (return_address)
+	{
+		owner_id owner=find_pe_return_address(return_address);
+		if (owner) return owner;
+	}
+	if (t_pe_image) return t_pe_image;
+	// not entered through a scope, e.g. a protocol function called directly
+	// by a debug module
 	void* ipbuf[80];
 	int len=backtrace(ipbuf,80);
 	for (int i=0;i<len;i++)
 	{
-		auto* map=g_pe_map.lookup((intptr_t)ipbuf[i]);
-		if (map) return map->second.c_str();
+		owner_id owner=find_pe_image(ipbuf[i],NULL);
+		if (owner) return owner;
 	}
-	return NULL;
+	return 0;
+}
+
+const char* find_pe_caller_id(void* return_address)
+{
+	owner_id owner=find_pe_caller(return_address);
+	return owner ? owner_name(owner) : NULL;
 }
 
 extern "C"
@@ -80,18 +169,35 @@ void* wrapped_mmap(void *addr, size_t length, int prot, int flags, int fd, off_t
 	if (p && p!=MAP_FAILED)
 	{
 		fprintf(stdout,"PE mmap: start=%016lx, end=%016lx\n",(intptr_t)p,length-1+(intptr_t)p);
-		register_memory({p,length,"JEMALLOC_HEAP"});
+		register_memory({p,length,0,MEMORY_HEAP});
+		memmap_add(p,length,EfiConventionalMemory);
 	}
 	return p;
 }
 }
 
 // seperate function so we can set a breakpoint easily
-static void start_pe(EFI_IMAGE_ENTRY_POINT entry,EFI_HANDLE handle,EFI_SYSTEM_TABLE* table)
+static void start_pe(EFI_IMAGE_ENTRY_POINT entry,owner_id owner,EFI_HANDLE handle,EFI_SYSTEM_TABLE* table)
 {
+	pe_call_scope scope(owner);
 	entry(handle,table);
 }
 
+struct pe_start
+{
+	EFI_IMAGE_ENTRY_POINT entry;
+	owner_id owner;
+	const char* id;
+};
+
+static void start_pe_coroutine(void* arg)
+{
+	pe_start* start=(pe_start*)arg;
+	start_pe(start->entry,start->owner,(EFI_HANDLE)start->id,&g_efi_system_table);
+	fprintf(stdout,"Exited gracefully: %s\n",start->id);
+	delete start;
+}
+
 void run_pe(const char* id,const char* filename)
 {
 	int fd=open(filename,O_RDONLY);
@@ -99,17 +205,30 @@ void run_pe(const char* id,const char* filename)
 	{
 		auto pe_info=load_pe(fd);
 		g_pe_map.erase((intptr_t)pe_info.mmap_base,pe_info.mmap_length+(intptr_t)pe_info.mmap_base);
-		g_pe_map.insert((intptr_t)pe_info.mmap_base,pe_info.mmap_length+(intptr_t)pe_info.mmap_base,{pe_info,string(id)});
-		register_memory({pe_info.mmap_base,(size_t)pe_info.image_base-(size_t)pe_info.mmap_base,string(id)+"::IMAGE_MMAP"});
-		register_memory({pe_info.image_base,pe_info.mmap_length-((intptr_t)pe_info.image_base-(intptr_t)pe_info.mmap_base),string(id)+"::IMAGE_BASE"});
+		owner_id owner=intern_owner(id);
+		g_pe_map.insert((intptr_t)pe_info.mmap_base,pe_info.mmap_length+(intptr_t)pe_info.mmap_base,{pe_info,owner});
+		g_pe_generation++;
+		arenas_add_image(owner);
+		register_memory({pe_info.mmap_base,(size_t)pe_info.image_base-(size_t)pe_info.mmap_base,owner,MEMORY_IMAGE_MMAP});
+		register_memory({pe_info.image_base,pe_info.mmap_length-((intptr_t)pe_info.image_base-(intptr_t)pe_info.mmap_base),owner,MEMORY_IMAGE_BASE});
+		memmap_add(pe_info.mmap_base,pe_info.mmap_length,EfiBootServicesCode);
 		auto entry=(EFI_IMAGE_ENTRY_POINT)pe_info.entry_point;
 		close(fd);
 		
 		fprintf(stdout,"Loaded %s at %p\n",id,pe_info.image_base);
 
+		if (g_interleave)
+		{
+			// started by sched_run
+			if (entry) sched_spawn(id,start_pe_coroutine,new pe_start{entry,owner,id});
+			memtrace_arm();
+			return;
+		}
+		memtrace_arm();
 		if (entry)
-			start_pe(entry,(EFI_HANDLE)id,&g_efi_system_table);
+			start_pe(entry,owner,(EFI_HANDLE)id,&g_efi_system_table);
 		fprintf(stdout,"Exited gracefully\n");
+		expire_timers();
 	}
 }
 
@@ -145,24 +264,123 @@ static void stack_init()
 	}
 	if (stackhi && stacklo)
 	{
-		register_memory({(void*)stacklo,(size_t)(stackhi-stacklo),"STACK"});
+		register_memory({(void*)stacklo,(size_t)(stackhi-stacklo),0,MEMORY_STACK});
+		memmap_add((void*)stacklo,stackhi-stacklo,EfiBootServicesData);
 	}
 }
 
+// Writes DIR/NN-name.snap, numbered so that runs can be compared phase by phase
+static void take_snapshot(const char* name)
+{
+	if (!g_snapshot_dir) return;
+	char filename[PATH_MAX];
+	snprintf(filename,sizeof(filename),"%s/%02u-%s.snap",g_snapshot_dir,g_snapshot_phase++,name);
+	snapshot_write(filename);
+}
+
 void register_debug_module(debug_module_init_fn_t init, debug_module_run_fn_t run)
 {
 	if (init) g_init_fns.push_back(init);
 	if (run) g_run_fns.push_back(run);
 }
 
+// An event group to signal once a number of images have been run
+struct signal_point
+{
+	EFI_GUID group;
+	size_t after;
+};
+
+static const struct
+{
+	const char* name;
+	EFI_GUID* guid;
+} g_standard_groups[]={
+	{"end-of-dxe",&gEfiEndOfDxeEventGroupGuid},
+	{"ready-to-boot",&gEfiEventReadyToBootGuid},
+	{"exit-boot-services",&gEfiEventExitBootServicesGuid},
+};
+
+// GROUP[@N], where GROUP is one of the names above or a GUID
+static bool parse_signal_point(const char* arg,signal_point& point)
+{
+	const char* at=strchr(arg,'@');
+	size_t len=at ? at-arg : strlen(arg);
+	point.after=(size_t)-1;
+	if (at)
+	{
+		char* end;
+		point.after=strtoul(at+1,&end,10);
+		if (!at[1] || *end || !point.after) return false;
+	}
+	for (auto& g : g_standard_groups)
+	{
+		if (strlen(g.name)==len && !strncmp(g.name,arg,len))
+		{
+			point.group=*g.guid;
+			return true;
+		}
+	}
+	return parse_guid(arg,&point.group)==(int)len;
+}
+
+static void signal_points(const vector<signal_point>& points,size_t after)
+{
+	for (auto& point : points)
+	{
+		if (point.after!=after) continue;
+		EFI_GUID group=point.group;
+		fprintf(stdout,"Signalling event group %s\n",guid_string(&group));
+		signal_event_group(&group);
+	}
+}
+
+static void usage(const char* argv0)
+{
+	fprintf(stderr,"Usage: %s --unsafe [options] filename...\n",argv0);
+	fprintf(stderr,"Options:\n");
+	fprintf(stderr,"  --guid-db=FILE    Load additional GUID names (GUID,NAME per line)\n");
+	fprintf(stderr,"  --concurrent      Make the protocol registry and memory map safe for\n");
+	fprintf(stderr,"                    concurrent use\n");
+	fprintf(stderr,"  --graph=FILE      Write the protocol dependency graph (binary)\n");
+	fprintf(stderr,"  --graph-dot=FILE  Write the protocol dependency graph (DOT)\n");
+	fprintf(stderr,"  --dispatch-order=FILE\n");
+	fprintf(stderr,"                    Run images in dependency order according to a graph\n");
+	fprintf(stderr,"                    written by --graph\n");
+	fprintf(stderr,"  --fast-forward    Skip ahead in virtual time instead of sleeping in Stall\n");
+	fprintf(stderr,"                    and WaitForEvent\n");
+	fprintf(stderr,"  --trap-rdtsc      Make rdtsc in images return virtual time\n");
+	fprintf(stderr,"  --interleave      Load all images first, then run them as coroutines that\n");
+	fprintf(stderr,"                    switch whenever one blocks\n");
+	fprintf(stderr,"  --nvram=FILE      Import the variable stores in a ROM image or NVRAM dump\n");
+	fprintf(stderr,"  --varstore=FILE   Keep non-volatile variables in FILE across runs. Applied\n");
+	fprintf(stderr,"                    after any --nvram images.\n");
+	fprintf(stderr,"  --signal=GROUP[@N]\n");
+	fprintf(stderr,"                    Signal an event group after N images have run, or after\n");
+	fprintf(stderr,"                    all of them. GROUP is end-of-dxe, ready-to-boot,\n");
+	fprintf(stderr,"                    exit-boot-services or a GUID. May be repeated. With\n");
+	fprintf(stderr,"                    --interleave, N only counts loaded images.\n");
+	fprintf(stderr,"  --trace=LIST      Record which images access memory of the given kinds or\n");
+	fprintf(stderr,"                    owners (comma-separated, e.g. POOL,STACK,Foo.efi)\n");
+	fprintf(stderr,"  --trace-sample=USEC\n");
+	fprintf(stderr,"                    Only catch the first access to a traced page every USEC\n");
+	fprintf(stderr,"                    of CPU time\n");
+	fprintf(stderr,"  --snapshot=DIR    Write the memory map to DIR after initialization, after\n");
+	fprintf(stderr,"                    each image and at exit. Compare runs with snapdiff.\n");
+	fprintf(stderr,"  --guard-sample=N  Put about one in N pool and page allocations in front of\n");
+	fprintf(stderr,"                    a guard page and report overflows and uses after free\n");
+	fprintf(stderr,"  --arenas          Give each image its own allocator arena and report its\n");
+	fprintf(stderr,"                    allocations at exit\n");
+}
+
 int main(int argc, char** argv)
 {
-	if (argc<2 || argc>3 || (argc==3 && strcmp(argv[1],"--unsafe")) || (argc==2 && !strcmp(argv[1],"--unsafe")))
+	if (argc<2 || (argc==2 && !strcmp(argv[1],"--unsafe")))
 	{
-		fprintf(stderr,"Usage: %s filename\n",argv[0]);
+		usage(argv[0]);
 		return 1;
 	}
-	if (argc==2 || strcmp(argv[1],"--unsafe"))
+	if (strcmp(argv[1],"--unsafe"))
 	{
 		fputs("!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n",stderr);
 		fputs("!!!                                                                          !!!\n",stderr);
@@ -192,20 +410,163 @@ int main(int argc, char** argv)
 		return 1;
 	}
 
+	static const struct option options[]={
+		{"unsafe",  no_argument,      NULL,'u'},
+		{"guid-db", required_argument,NULL,'g'},
+		{"concurrent",no_argument,    NULL,'c'},
+		{"graph",   required_argument,NULL,'G'},
+		{"graph-dot",required_argument,NULL,'D'},
+		{"dispatch-order",required_argument,NULL,'o'},
+		{"fast-forward",no_argument,  NULL,'f'},
+		{"trap-rdtsc",no_argument,    NULL,'t'},
+		{"interleave",no_argument,    NULL,'i'},
+		{"signal",  required_argument,NULL,'s'},
+		{"nvram",   required_argument,NULL,'n'},
+		{"varstore",required_argument,NULL,'V'},
+		{"trace",   required_argument,NULL,'T'},
+		{"trace-sample",required_argument,NULL,'S'},
+		{"snapshot",required_argument,NULL,'P'},
+		{"guard-sample",required_argument,NULL,'A'},
+		{"arenas",  no_argument,      NULL,'a'},
+		{NULL,0,NULL,0}
+	};
+	const char* graph_file=NULL;
+	const char* graph_dot_file=NULL;
+	const char* dispatch_file=NULL;
+	const char* varstore_file=NULL;
+	const char* trace_spec=NULL;
+	unsigned long trace_sample=0;
+	vector<signal_point> points;
+	int opt;
+	while ((opt=getopt_long(argc,argv,"",options,NULL))!=-1)
+	{
+		switch (opt)
+		{
+			case 'u':
+				break;
+			case 'g':
+				if (!load_guid_database(optarg)) return 1;
+				break;
+			case 'c':
+				set_concurrent_registry(true);
+				set_concurrent_memory_map(true);
+				break;
+			case 'G':
+				graph_file=optarg;
+				depgraph_enable();
+				break;
+			case 'D':
+				graph_dot_file=optarg;
+				depgraph_enable();
+				break;
+			case 'o':
+				dispatch_file=optarg;
+				break;
+			case 'f':
+				vclock_set_fast_forward(true);
+				break;
+			case 't':
+				if (!vclock_trap_rdtsc()) return 1;
+				break;
+			case 'i':
+				g_interleave=true;
+				break;
+			case 'n':
+				if (!import_nvram(optarg)) return 1;
+				break;
+			case 'V':
+				varstore_file=optarg;
+				break;
+			case 'T':
+				trace_spec=optarg;
+				break;
+			case 'S':
+				trace_sample=strtoul(optarg,NULL,0);
+				break;
+			case 'A':
+				if (!guardalloc_init(strtoul(optarg,NULL,0))) return 1;
+				break;
+			case 'a':
+				if (!arenas_init()) return 1;
+				break;
+			case 'P':
+				g_snapshot_dir=optarg;
+				if (mkdir(optarg,0777) && errno!=EEXIST)
+				{
+					perror(optarg);
+					return 1;
+				}
+				break;
+			case 's':
+			{
+				signal_point point;
+				if (!parse_signal_point(optarg,point))
+				{
+					fprintf(stderr,"Invalid event group: %s\n",optarg);
+					return 1;
+				}
+				points.push_back(point);
+				break;
+			}
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+	if (optind>=argc)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	vector<const char*> images(argv+optind,argv+argc);
+	if (dispatch_file && !depgraph_dispatch_order(dispatch_file,images)) return 1;
+	if (varstore_file && !open_variable_log(varstore_file)) return 1;
+	if (trace_spec && !memtrace_init(trace_spec,trace_sample)) return 1;
+
 	stack_init();
 	efi_hooks_init();
 	for (auto fn: g_init_fns) fn();
+	take_snapshot("init");
 
 	printf("Intialization done. Loading images.\n");
 #ifndef DEBUG
 	alarm(10);
 #endif
-	// If you want to load multiple PE images at the same time, this is where
-	// you want to do that with more calls to run_pe().
-	run_pe("MAIN_PE_IMAGE",argv[2]);
+	// Images are identified by their file name, which keeps IDs stable
+	// between runs for --dispatch-order.
+	for (size_t i=0;i<images.size();i++)
+	{
+		const char* id=strrchr(images[i],'/');
+		run_pe(id ? id+1 : images[i],images[i]);
+		take_snapshot(id ? id+1 : images[i]);
+		signal_points(points,i+1);
+	}
+	if (g_interleave)
+	{
+		sched_run();
+		signal_points(points,(size_t)-1);
+		// let images resume that were waiting for the groups
+		if (!points.empty()) sched_run();
+	}
+	else
+	{
+		signal_points(points,(size_t)-1);
+	}
 
+	expire_timers();
 	printf("Done loading images. Executing user functions.\n");
 	for (auto fn: g_run_fns) fn();
+
+	memtrace_report();
+	guardalloc_report();
+	arenas_report();
+	take_snapshot("exit");
+	close_variable_log();
+	print_protocol_cache_stats();
+	print_memory_cache_stats();
+	print_allocation_stats();
+	if (graph_file) depgraph_export(graph_file);
+	if (graph_dot_file) depgraph_export_dot(graph_dot_file);
 	
 	return 0;
 }
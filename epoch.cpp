@@ -0,0 +1,112 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "epoch.hpp"
+
+#define EPOCH_MAX_THREADS 256
+
+struct alignas(64) epoch_slot
+{
+	std::atomic<unsigned long> epoch; // 0 when the thread is not reading
+	std::atomic<bool> used;
+};
+
+struct retired_ptr
+{
+	void* p;
+	void (*deleter)(void*);
+	unsigned long epoch;
+};
+
+static epoch_slot g_slots[EPOCH_MAX_THREADS];
+static std::atomic<unsigned long> g_epoch(1);
+static std::mutex g_retired_lock;
+static std::vector<retired_ptr> g_retired;
+
+// Claims a slot for the calling thread on first use and releases it again on
+// thread exit.
+struct thread_slot
+{
+	epoch_slot* slot=NULL;
+	unsigned int depth=0;
+
+	epoch_slot* get()
+	{
+		if (slot) return slot;
+		for (auto& s : g_slots)
+		{
+			bool expected=false;
+			if (s.used.compare_exchange_strong(expected,true))
+				return slot=&s;
+		}
+		fprintf(stderr,"More than %d threads using epoch_guard\nAborted\n",EPOCH_MAX_THREADS);
+		_exit(0);
+	}
+
+	~thread_slot()
+	{
+		if (slot) slot->used.store(false,std::memory_order_release);
+	}
+};
+
+static thread_local thread_slot t_slot;
+
+epoch_guard::epoch_guard(bool enable) : active(enable)
+{
+	if (!active || t_slot.depth++) return;
+	t_slot.get()->epoch.store(g_epoch.load(std::memory_order_acquire),std::memory_order_relaxed);
+	// order the slot store before any load of the protected pointer
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+epoch_guard::~epoch_guard()
+{
+	if (!active || --t_slot.depth) return;
+	t_slot.slot->epoch.store(0,std::memory_order_release);
+}
+
+void epoch_retire(void* p,void (*deleter)(void*))
+{
+	std::lock_guard<std::mutex> lock(g_retired_lock);
+	// Readers that entered at or before this epoch may still hold p.
+	g_retired.push_back({p,deleter,g_epoch.fetch_add(1,std::memory_order_seq_cst)});
+
+	unsigned long oldest=~0UL;
+	for (auto& s : g_slots)
+	{
+		unsigned long e=s.epoch.load(std::memory_order_acquire);
+		if (e && e<oldest) oldest=e;
+	}
+	size_t kept=0;
+	for (auto& r : g_retired)
+	{
+		if (r.epoch<oldest)
+			r.deleter(r.p);
+		else
+			g_retired[kept++]=r;
+	}
+	g_retired.resize(kept);
+}
@@ -0,0 +1,47 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef EPOCH_H
+#define EPOCH_H
+
+/// Epoch-based reclamation for read-mostly structures that are published
+/// through an atomic pointer. Readers hold an epoch_guard while they use a
+/// snapshot; entering and leaving are a store and a fence, never a wait.
+/// Writers replace the pointer and hand the old snapshot to epoch_retire,
+/// which frees it once no reader that could have seen it is still active.
+class epoch_guard
+{
+	bool active;
+public:
+	/// @param enable Whether to actually enter an epoch. Allows callers to
+	///               skip the fence when concurrency is switched off.
+	explicit epoch_guard(bool enable=true);
+	~epoch_guard();
+	epoch_guard(const epoch_guard&)=delete;
+	epoch_guard& operator=(const epoch_guard&)=delete;
+};
+
+void epoch_retire(void* p,void (*deleter)(void*));
+
+template<typename T> void epoch_retire(T* p)
+{
+	epoch_retire(p,[](void* q){ delete (T*)q; });
+}
+
+#endif //EPOCH_H
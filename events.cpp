@@ -0,0 +1,504 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+using std::deque;
+using std::vector;
+
+#include "main.h"
+#include "events.h"
+#include "scheduler.h"
+#include "vclock.h"
+extern "C" {
+#include "efi_guid.h"
+}
+
+#define EVENT_MAGIC 0x544e5645 // 'EVNT'
+#define NOT_ARMED ((size_t)-1)
+
+struct efi_event
+{
+	UINT32 magic;
+	UINT32 type;
+	EFI_TPL notify_tpl;
+	EFI_EVENT_NOTIFY notify_function;
+	owner_id notify_image; // image containing notify_function, or 0
+	VOID* notify_context;
+	bool signaled;
+	bool notify_pending;
+	UINT64 trigger_time; // absolute, in 100ns units
+	UINT64 period;       // 0 for one-shot timers
+	size_t heap_index;   // position in g_timers or NOT_ARMED
+	bool in_group;
+	EFI_GUID group;
+};
+
+// All event state is protected by g_events_lock. Notify functions are called
+// without holding it, since they usually call back into the event services.
+static std::mutex g_events_lock;
+static std::condition_variable g_events_cv;
+static vector<efi_event*> g_timers; // min-heap on trigger_time
+static guid_table<vector<efi_event*>> g_event_groups;
+
+// Pending notifications are queued per TPL. Bit n of g_pending_mask is set
+// while g_pending_notifies[n] is non-empty; it is read without the lock so
+// that RestoreTPL can tell cheaply whether there is anything to do.
+static deque<efi_event*> g_pending_notifies[TPL_HIGH_LEVEL+1];
+static std::atomic<UINT32> g_pending_mask(0);
+
+static thread_local EFI_TPL t_current_tpl=TPL_APPLICATION;
+
+// Pending levels that may run at the given TPL
+static UINT32 runnable_above(EFI_TPL tpl)
+{
+	return g_pending_mask.load(std::memory_order_relaxed)&~((2U<<tpl)-1);
+}
+
+static efi_event* as_event(EFI_EVENT Event)
+{
+	efi_event* e=(efi_event*)Event;
+	return (e && e->magic==EVENT_MAGIC) ? e : NULL;
+}
+
+/* Timer heap */
+
+static void heap_set(size_t i,efi_event* e)
+{
+	g_timers[i]=e;
+	e->heap_index=i;
+}
+
+static void heap_sift_up(size_t i)
+{
+	efi_event* e=g_timers[i];
+	while (i>0)
+	{
+		size_t parent=(i-1)/2;
+		if (g_timers[parent]->trigger_time<=e->trigger_time) break;
+		heap_set(i,g_timers[parent]);
+		i=parent;
+	}
+	heap_set(i,e);
+}
+
+static void heap_sift_down(size_t i)
+{
+	efi_event* e=g_timers[i];
+	size_t n=g_timers.size();
+	for (;;)
+	{
+		size_t child=2*i+1;
+		if (child>=n) break;
+		if (child+1<n && g_timers[child+1]->trigger_time<g_timers[child]->trigger_time) child++;
+		if (e->trigger_time<=g_timers[child]->trigger_time) break;
+		heap_set(i,g_timers[child]);
+		i=child;
+	}
+	heap_set(i,e);
+}
+
+static void timer_disarm(efi_event* e)
+{
+	size_t i=e->heap_index;
+	if (i==NOT_ARMED) return;
+	e->heap_index=NOT_ARMED;
+	efi_event* last=g_timers.back();
+	g_timers.pop_back();
+	if (last==e) return;
+	heap_set(i,last);
+	heap_sift_up(i);
+	heap_sift_down(last->heap_index);
+}
+
+static void timer_arm(efi_event* e,UINT64 trigger_time)
+{
+	timer_disarm(e);
+	e->trigger_time=trigger_time;
+	g_timers.push_back(e);
+	heap_sift_up(g_timers.size()-1);
+}
+
+/* Signalling */
+
+static void queue_notify_locked(efi_event* e)
+{
+	if (e->notify_pending) return;
+	e->notify_pending=true;
+	g_pending_notifies[e->notify_tpl].push_back(e);
+	g_pending_mask.fetch_or(1U<<e->notify_tpl,std::memory_order_relaxed);
+}
+
+static void signal_event_locked(efi_event* e)
+{
+	if (e->signaled) return;
+	e->signaled=true;
+	if (e->type&EVT_NOTIFY_SIGNAL) queue_notify_locked(e);
+	g_events_cv.notify_all();
+	sched_wake_waiters();
+}
+
+static void signal_group_locked(EFI_GUID const& group)
+{
+	vector<efi_event*>* members=g_event_groups.find(group);
+	if (!members) return;
+	for (auto e : *members) signal_event_locked(e);
+}
+
+// Pops expired timers off the heap in one batch and signals them.
+static void dispatch_timers_locked()
+{
+	UINT64 now=vclock_now();
+	while (!g_timers.empty() && g_timers[0]->trigger_time<=now)
+	{
+		efi_event* e=g_timers[0];
+		if (e->period)
+		{
+			// skip periods that were missed entirely instead of firing a burst
+			UINT64 next=e->trigger_time+e->period;
+			if (next<=now) next=now+e->period-(now-e->trigger_time)%e->period;
+			e->trigger_time=next;
+			heap_sift_down(0);
+		}
+		else
+		{
+			timer_disarm(e);
+		}
+		signal_event_locked(e);
+	}
+}
+
+// Runs queued notify functions above the current TPL, highest TPL first. Each
+// function runs at its own TPL. Must be called without g_events_lock held.
+static void dispatch_notifies()
+{
+	EFI_TPL tpl=t_current_tpl;
+	for (;;)
+	{
+		std::unique_lock<std::mutex> lock(g_events_lock);
+		UINT32 runnable=runnable_above(tpl);
+		if (!runnable) return;
+		EFI_TPL level=31-__builtin_clz(runnable);
+		deque<efi_event*>& queue=g_pending_notifies[level];
+		efi_event* e=queue.front();
+		queue.pop_front();
+		if (queue.empty()) g_pending_mask.fetch_and(~(1U<<level),std::memory_order_relaxed);
+		e->notify_pending=false;
+		// a signal type event's signal state is consumed by its notification
+		if (e->type&EVT_NOTIFY_SIGNAL) e->signaled=false;
+		EFI_EVENT_NOTIFY fn=e->notify_function;
+		owner_id image=e->notify_image;
+		VOID* context=e->notify_context;
+		lock.unlock();
+		t_current_tpl=level;
+		{
+			pe_call_scope scope(image);
+			fn(e,context);
+		}
+		t_current_tpl=tpl;
+	}
+}
+
+void expire_timers()
+{
+	{
+		std::lock_guard<std::mutex> lock(g_events_lock);
+		if (vclock_fast_forward())
+		{
+			UINT64 deadline=0;
+			for (auto e : g_timers) deadline=std::max(deadline,e->trigger_time);
+			vclock_skip_to(deadline);
+		}
+		dispatch_timers_locked();
+	}
+	dispatch_notifies();
+}
+
+void signal_event_group(EFI_GUID* group)
+{
+	{
+		std::lock_guard<std::mutex> lock(g_events_lock);
+		signal_group_locked(*group);
+	}
+	dispatch_notifies();
+}
+
+/* Boot services */
+
+EFI_STATUS EFIAPI CreateEvent(IN UINT32 Type, IN EFI_TPL NotifyTpl, IN EFI_EVENT_NOTIFY NotifyFunction, IN VOID *NotifyContext, OUT EFI_EVENT *Event)
+{
+	return CreateEventEx(Type,NotifyTpl,NotifyFunction,NotifyContext,NULL,Event);
+}
+
+EFI_STATUS EFIAPI CreateEventEx(IN UINT32 Type, IN EFI_TPL NotifyTpl, IN EFI_EVENT_NOTIFY NotifyFunction OPTIONAL, IN CONST VOID *NotifyContext OPTIONAL, IN CONST EFI_GUID *EventGroup OPTIONAL, OUT EFI_EVENT *Event)
+{
+	if (Event==NULL) return EFI_INVALID_PARAMETER;
+	// these two types are shorthands for joining the corresponding group
+	if (Type==EVT_SIGNAL_EXIT_BOOT_SERVICES || Type==EVT_SIGNAL_VIRTUAL_ADDRESS_CHANGE)
+	{
+		if (EventGroup) return EFI_INVALID_PARAMETER;
+		EventGroup=(Type==EVT_SIGNAL_EXIT_BOOT_SERVICES) ? &gEfiEventExitBootServicesGuid : &gEfiEventVirtualAddressChangeGuid;
+	}
+	if ((Type&EVT_NOTIFY_WAIT) && (Type&EVT_NOTIFY_SIGNAL)) return EFI_INVALID_PARAMETER;
+	if ((Type&(EVT_NOTIFY_WAIT|EVT_NOTIFY_SIGNAL)) && (NotifyFunction==NULL || NotifyTpl<=TPL_APPLICATION || NotifyTpl>=TPL_HIGH_LEVEL))
+		return EFI_INVALID_PARAMETER;
+
+	efi_event* e=new efi_event();
+	e->magic=EVENT_MAGIC;
+	e->type=Type;
+	e->notify_tpl=NotifyTpl;
+	e->notify_function=NotifyFunction;
+	e->notify_image=NotifyFunction ? find_pe_image((void*)NotifyFunction,NULL) : 0;
+	e->notify_context=(VOID*)NotifyContext;
+	e->heap_index=NOT_ARMED;
+	if (EventGroup)
+	{
+		e->in_group=true;
+		e->group=*EventGroup;
+		std::lock_guard<std::mutex> lock(g_events_lock);
+		g_event_groups[*EventGroup].push_back(e);
+	}
+	*Event=e;
+
+	fprintf(stdout,"CreateEvent\n  type=%08x tpl=%lu @address %016lx\n",Type,NotifyTpl,(intptr_t)e);
+	if (EventGroup) fprintf(stdout,"  group=%s\n",guid_string(&e->group));
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS EFIAPI SetTimer(IN EFI_EVENT Event, IN EFI_TIMER_DELAY Type, IN UINT64 TriggerTime)
+{
+	std::lock_guard<std::mutex> lock(g_events_lock);
+	efi_event* e=as_event(Event);
+	if (e==NULL || !(e->type&EVT_TIMER)) return EFI_INVALID_PARAMETER;
+
+	switch (Type)
+	{
+		case TimerCancel:
+			timer_disarm(e);
+			break;
+		case TimerPeriodic:
+			e->period=TriggerTime ? TriggerTime : 1;
+			timer_arm(e,vclock_now()+e->period);
+			break;
+		case TimerRelative:
+			e->period=0;
+			timer_arm(e,vclock_now()+TriggerTime);
+			break;
+		default:
+			return EFI_INVALID_PARAMETER;
+	}
+	g_events_cv.notify_all();
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS EFIAPI SignalEvent(IN EFI_EVENT Event)
+{
+	{
+		std::lock_guard<std::mutex> lock(g_events_lock);
+		efi_event* e=as_event(Event);
+		if (e==NULL) return EFI_INVALID_PARAMETER;
+		// signalling any member signals the whole group
+		if (e->in_group)
+			signal_group_locked(e->group);
+		else
+			signal_event_locked(e);
+	}
+	dispatch_notifies();
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS EFIAPI CloseEvent(IN EFI_EVENT Event)
+{
+	std::lock_guard<std::mutex> lock(g_events_lock);
+	efi_event* e=as_event(Event);
+	if (e==NULL) return EFI_INVALID_PARAMETER;
+
+	timer_disarm(e);
+	if (e->in_group)
+	{
+		vector<efi_event*>& members=g_event_groups[e->group];
+		members.erase(std::find(members.begin(),members.end(),e));
+		if (members.empty()) g_event_groups.erase(e->group);
+	}
+	if (e->notify_pending)
+	{
+		deque<efi_event*>& queue=g_pending_notifies[e->notify_tpl];
+		for (auto it=queue.begin();it!=queue.end();++it)
+		{
+			if (*it==e)
+			{
+				queue.erase(it);
+				break;
+			}
+		}
+		if (queue.empty()) g_pending_mask.fetch_and(~(1U<<e->notify_tpl),std::memory_order_relaxed);
+	}
+	e->magic=0;
+	delete e;
+
+	return EFI_SUCCESS;
+}
+
+// Checks the signal state of a non-signal-type event, running its notify
+// function if it has one and is not signalled yet.
+static EFI_STATUS check_event(efi_event* e)
+{
+	{
+		std::lock_guard<std::mutex> lock(g_events_lock);
+		dispatch_timers_locked();
+		if (!e->signaled && (e->type&EVT_NOTIFY_WAIT)) queue_notify_locked(e);
+	}
+	dispatch_notifies();
+
+	std::lock_guard<std::mutex> lock(g_events_lock);
+	if (!e->signaled) return EFI_NOT_READY;
+	e->signaled=false;
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS EFIAPI CheckEvent(IN EFI_EVENT Event)
+{
+	efi_event* e;
+	{
+		std::lock_guard<std::mutex> lock(g_events_lock);
+		e=as_event(Event);
+		if (e==NULL || (e->type&EVT_NOTIFY_SIGNAL)) return EFI_INVALID_PARAMETER;
+	}
+	return check_event(e);
+}
+
+EFI_STATUS EFIAPI WaitForEvent(IN UINTN NumberOfEvents, IN EFI_EVENT *Event, OUT UINTN *Index)
+{
+	if (NumberOfEvents==0 || Event==NULL || Index==NULL) return EFI_INVALID_PARAMETER;
+	if (t_current_tpl!=TPL_APPLICATION) return EFI_UNSUPPORTED;
+
+	bool polled=false;
+	{
+		std::lock_guard<std::mutex> lock(g_events_lock);
+		for (UINTN i=0;i<NumberOfEvents;i++)
+		{
+			efi_event* e=as_event(Event[i]);
+			if (e==NULL || (e->type&EVT_NOTIFY_SIGNAL))
+			{
+				*Index=i;
+				return EFI_INVALID_PARAMETER;
+			}
+			if (e->type&EVT_NOTIFY_WAIT) polled=true;
+		}
+	}
+
+	bool warned=false;
+	for (;;)
+	{
+		for (UINTN i=0;i<NumberOfEvents;i++)
+		{
+			if (check_event((efi_event*)Event[i])==EFI_SUCCESS)
+			{
+				*Index=i;
+				return EFI_SUCCESS;
+			}
+		}
+
+		// Sleep until the next timer expires or another thread signals
+		// something. Notify-wait functions have to be polled, but not more
+		// often than every millisecond.
+		std::unique_lock<std::mutex> lock(g_events_lock);
+		UINT64 deadline=~0ULL;
+		if (!g_timers.empty()) deadline=g_timers[0]->trigger_time;
+		if (polled) deadline=std::min(deadline,vclock_now()+10000);
+		if (sched_active())
+		{
+			// let other images run in the meantime
+			lock.unlock();
+			sched_wait_until(deadline);
+		}
+		else if (deadline==~0ULL)
+		{
+			if (!warned) fprintf(stdout,"WaitForEvent: no timers armed, waiting for another thread\n");
+			warned=true;
+			g_events_cv.wait(lock);
+		}
+		else if (vclock_fast_forward())
+		{
+			vclock_skip_to(deadline);
+		}
+		else
+		{
+			UINT64 now=vclock_now();
+			if (deadline>now)
+				g_events_cv.wait_for(lock,std::chrono::nanoseconds((deadline-now)*100));
+		}
+	}
+}
+
+EFI_STATUS EFIAPI Stall(IN UINTN Microseconds)
+{
+	UINT64 end=vclock_now()+Microseconds*10ULL;
+	for (;;)
+	{
+		// wake up for every timer that expires during the stall
+		UINT64 next=end;
+		{
+			std::lock_guard<std::mutex> lock(g_events_lock);
+			dispatch_timers_locked();
+			if (!g_timers.empty()) next=std::min(next,g_timers[0]->trigger_time);
+		}
+		dispatch_notifies();
+		if (vclock_now()>=end) return EFI_SUCCESS;
+		if (sched_active())
+			sched_wait_until(next);
+		else
+			vclock_sleep_until(next);
+	}
+}
+
+/* Task priority levels */
+
+EFI_TPL current_tpl()
+{
+	return t_current_tpl;
+}
+
+void set_current_tpl(EFI_TPL tpl)
+{
+	t_current_tpl=tpl;
+}
+
+EFI_TPL EFIAPI RaiseTPL(IN EFI_TPL NewTpl)
+{
+	EFI_TPL old=t_current_tpl;
+	t_current_tpl=std::min<EFI_TPL>(NewTpl,TPL_HIGH_LEVEL);
+	return old;
+}
+
+VOID EFIAPI RestoreTPL(IN EFI_TPL OldTpl)
+{
+	t_current_tpl=std::min<EFI_TPL>(OldTpl,TPL_HIGH_LEVEL);
+	if (runnable_above(t_current_tpl)) dispatch_notifies();
+}
@@ -0,0 +1,50 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <efi.h>
+
+EFI_STATUS EFIAPI CreateEvent(IN UINT32 Type, IN EFI_TPL NotifyTpl, IN EFI_EVENT_NOTIFY NotifyFunction, IN VOID *NotifyContext, OUT EFI_EVENT *Event);
+EFI_STATUS EFIAPI CreateEventEx(IN UINT32 Type, IN EFI_TPL NotifyTpl, IN EFI_EVENT_NOTIFY NotifyFunction OPTIONAL, IN CONST VOID *NotifyContext OPTIONAL, IN CONST EFI_GUID *EventGroup OPTIONAL, OUT EFI_EVENT *Event);
+EFI_STATUS EFIAPI SetTimer(IN EFI_EVENT Event, IN EFI_TIMER_DELAY Type, IN UINT64 TriggerTime);
+EFI_STATUS EFIAPI WaitForEvent(IN UINTN NumberOfEvents, IN EFI_EVENT *Event, OUT UINTN *Index);
+EFI_STATUS EFIAPI SignalEvent(IN EFI_EVENT Event);
+EFI_STATUS EFIAPI CloseEvent(IN EFI_EVENT Event);
+EFI_STATUS EFIAPI CheckEvent(IN EFI_EVENT Event);
+EFI_STATUS EFIAPI Stall(IN UINTN Microseconds);
+EFI_TPL    EFIAPI RaiseTPL(IN EFI_TPL NewTpl);
+VOID       EFIAPI RestoreTPL(IN EFI_TPL OldTpl);
+
+// Signals expired timers and runs their notify functions, for timers that
+// images arm in their entry point before returning, which would otherwise
+// only fire while another image stalls or waits. In fast-forward mode,
+// virtual time first skips ahead until every armed timer has expired once.
+void expire_timers();
+
+// Signals every event in a group, as SignalEvent on one of its members would.
+void signal_event_group(EFI_GUID* group);
+
+// The calling thread's TPL, saved and restored by the scheduler when it
+// switches between images.
+EFI_TPL current_tpl();
+void set_current_tpl(EFI_TPL tpl);
+
+#endif //EVENTS_H
@@ -0,0 +1,277 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <execinfo.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+using std::atomic;
+
+#include "main.h"
+#include "guardalloc.h"
+
+/* The pool is one mapping of GUARD_SLOTS slots, each preceded and followed by
+ * a guard page:
+ *
+ *   | guard | slot 0 | guard | slot 1 | guard | ... | slot N-1 | guard |
+ *
+ * An object is aligned to the end of its slot, rounded to 8 bytes like
+ * jemalloc's smallest size class, and only the pages it occupies are made
+ * accessible. Reading or writing past its end hits the guard page, and
+ * before its start the unused part of the slot. Free slots are handed out in
+ * FIFO order, so a freed slot is quarantined until all others have been used.
+ *
+ * Sampling costs one thread-local decrement per allocation; the interval to
+ * the next sampled allocation is random so that allocation patterns that
+ * repeat with a fixed period still get sampled.
+ */
+
+#define GUARD_PAGE 4096
+#define GUARD_SLOT_SIZE (16*GUARD_PAGE) // largest allocation that can be sampled
+#define GUARD_SLOTS 256
+#define GUARD_STRIDE (GUARD_SLOT_SIZE+GUARD_PAGE)
+#define GUARD_STACK 16
+#define PF_WRITE 0x2
+
+struct guard_slot
+{
+	intptr_t start; // 0 if never used
+	size_t size;
+	bool live;
+	owner_id alloc_owner,free_owner;
+	int alloc_depth,free_depth;
+	void* alloc_stack[GUARD_STACK];
+	void* free_stack[GUARD_STACK];
+};
+
+static intptr_t g_pool=0;
+static unsigned long g_sample_rate=0;
+static guard_slot g_slots[GUARD_SLOTS];
+static std::deque<size_t> g_free_slots;
+static std::mutex g_lock;
+static atomic<unsigned long> g_guarded{0};
+static atomic<unsigned long> g_pool_full{0};
+static struct sigaction g_prev_sigsegv;
+
+static thread_local unsigned long t_countdown=0;
+static thread_local UINT64 t_rng=0;
+
+static intptr_t slot_base(size_t i)
+{
+	return g_pool+GUARD_PAGE+i*GUARD_STRIDE;
+}
+
+static size_t slot_index(intptr_t addr) // addr must lie within the pool
+{
+	return (addr-g_pool)/GUARD_STRIDE;
+}
+
+// Uniform in [1,2*rate-1], so one in rate allocations on average
+static unsigned long next_interval()
+{
+	if (!t_rng) t_rng=(UINT64)(intptr_t)&t_rng^(UINT64)time(NULL)*0x9e3779b97f4a7c15ULL;
+	t_rng^=t_rng<<13;
+	t_rng^=t_rng>>7;
+	t_rng^=t_rng<<17;
+	return g_sample_rate>1 ? t_rng%(2*g_sample_rate-1)+1 : 1;
+}
+
+// The innermost image on a stack, like find_pe_caller
+static owner_id stack_owner(void** stack,int depth)
+{
+	for (int i=0;i<depth;i++)
+	{
+		owner_id owner=find_pe_image(stack[i],NULL);
+		if (owner) return owner;
+	}
+	return 0;
+}
+
+// Prints the frames of a stack that lie in PE images
+static void print_stack(const char* what,owner_id owner,void** stack,int depth)
+{
+	fprintf(stdout,"  %s %s\n",what,owner ? owner_name(owner) : "efiperun");
+	for (int i=0;i<depth;i++)
+	{
+		void* base;
+		owner_id image=find_pe_image(stack[i],&base);
+		if (image) fprintf(stdout,"    #%d %s+%08lx\n",i,owner_name(image),(intptr_t)stack[i]-(intptr_t)base);
+	}
+}
+
+static void report(intptr_t addr,intptr_t pc,bool write)
+{
+	// A fault in a guard page is blamed on the slot in front of it, since
+	// objects sit at the end of their slots.
+	size_t i=addr<slot_base(0) ? 0 : slot_index(addr-GUARD_PAGE);
+	if (!g_slots[i].start && i+1<GUARD_SLOTS && addr>=slot_base(i)+GUARD_SLOT_SIZE) i++;
+	guard_slot& slot=g_slots[i];
+	const char* access=write ? "write" : "read";
+
+	if (!slot.start)
+		fprintf(stdout,"GuardAlloc: wild %s at %016lx in the guarded pool\n",access,addr);
+	else if (addr>=slot.start && addr<slot.start+(intptr_t)slot.size)
+		fprintf(stdout,"GuardAlloc: use after free, %s at %016lx, %lx bytes into block %016lx (size=%lx)\n",
+			access,addr,addr-slot.start,slot.start,slot.size);
+	else if (addr>=slot.start)
+		fprintf(stdout,"GuardAlloc: buffer overflow, %s at %016lx, %lx bytes after %sblock %016lx (size=%lx)\n",
+			access,addr,addr-slot.start-slot.size,slot.live ? "" : "freed ",slot.start,slot.size);
+	else
+		fprintf(stdout,"GuardAlloc: buffer underflow, %s at %016lx, %lx bytes before %sblock %016lx (size=%lx)\n",
+			access,addr,slot.start-addr,slot.live ? "" : "freed ",slot.start,slot.size);
+
+	void* base;
+	owner_id image=find_pe_image((void*)pc,&base);
+	if (image)
+		fprintf(stdout,"  at %s+%08lx\n",owner_name(image),pc-(intptr_t)base);
+	else
+		fprintf(stdout,"  at %016lx\n",pc);
+	void* stack[GUARD_STACK];
+	int depth=backtrace(stack,GUARD_STACK);
+	print_stack("accessed by",stack_owner(stack,depth),stack,depth);
+	if (slot.start)
+	{
+		print_stack("allocated by",slot.alloc_owner,slot.alloc_stack,slot.alloc_depth);
+		if (!slot.live) print_stack("freed by",slot.free_owner,slot.free_stack,slot.free_depth);
+	}
+	fflush(stdout);
+}
+
+static void guard_sigsegv(int sig,siginfo_t* info,void* ctx)
+{
+	intptr_t addr=(intptr_t)info->si_addr;
+	if (info->si_code!=SEGV_ACCERR || addr<g_pool || addr>=g_pool+GUARD_PAGE+GUARD_SLOTS*GUARD_STRIDE)
+		return chain_signal(g_prev_sigsegv,sig,info,ctx);
+
+	greg_t* regs=((ucontext_t*)ctx)->uc_mcontext.gregs;
+	report(addr,regs[REG_RIP],regs[REG_ERR]&PF_WRITE);
+	signal(sig,SIG_DFL); // the faulting instruction is restarted and kills us
+}
+
+bool guardalloc_init(unsigned long sample_rate)
+{
+	if (!sample_rate) return true;
+	size_t size=GUARD_PAGE+GUARD_SLOTS*GUARD_STRIDE;
+	void* pool=mmap(NULL,size,PROT_NONE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE,-1,0);
+	if (pool==MAP_FAILED)
+	{
+		perror("mmap");
+		return false;
+	}
+	g_pool=(intptr_t)pool;
+	g_sample_rate=sample_rate;
+	for (size_t i=0;i<GUARD_SLOTS;i++) g_free_slots.push_back(i);
+	// accessible as far as can_access is concerned, so that CopyMem and
+	// friends fault on the guard pages as well instead of ignoring the call
+	register_memory({pool,size,0,MEMORY_GUARD});
+
+	struct sigaction sa;
+	memset(&sa,0,sizeof(sa));
+	sa.sa_flags=SA_SIGINFO|SA_ONSTACK;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_sigaction=guard_sigsegv;
+	sigaction(SIGSEGV,&sa,&g_prev_sigsegv);
+	return true;
+}
+
+void* guardalloc_alloc(size_t size,owner_id owner)
+{
+	if (!g_sample_rate || size>GUARD_SLOT_SIZE) return NULL;
+	if (t_countdown>1)
+	{
+		t_countdown--;
+		return NULL;
+	}
+	bool first=!t_countdown;
+	t_countdown=next_interval();
+	if (first) return NULL; // start each thread at a random point
+
+	size_t i;
+	{
+		std::lock_guard<std::mutex> lock(g_lock);
+		if (g_free_slots.empty())
+		{
+			g_pool_full++;
+			return NULL;
+		}
+		i=g_free_slots.front();
+		g_free_slots.pop_front();
+	}
+	guard_slot& slot=g_slots[i];
+	size=std::max<size_t>(size,1);
+	intptr_t end=slot_base(i)+GUARD_SLOT_SIZE;
+	intptr_t start=end-((size+7)&~(size_t)7);
+	intptr_t page=start&~(intptr_t)(GUARD_PAGE-1);
+	if (mprotect((void*)page,end-page,PROT_READ|PROT_WRITE))
+	{
+		std::lock_guard<std::mutex> lock(g_lock);
+		g_free_slots.push_front(i);
+		return NULL;
+	}
+	slot.start=start;
+	slot.size=size;
+	slot.alloc_owner=owner;
+	slot.alloc_depth=backtrace(slot.alloc_stack,GUARD_STACK);
+	slot.free_depth=0;
+	slot.live=true;
+	g_guarded++;
+	return (void*)slot.start;
+}
+
+bool guardalloc_free(void* p,owner_id owner)
+{
+	intptr_t addr=(intptr_t)p;
+	if (!g_pool || addr<slot_base(0) || addr>=slot_base(GUARD_SLOTS)) return false;
+	size_t i=slot_index(addr-GUARD_PAGE);
+	guard_slot& slot=g_slots[i];
+	if (!slot.live || addr!=slot.start) return true; // FreePool's checks already complained
+
+	slot.live=false;
+	slot.free_owner=owner;
+	slot.free_depth=backtrace(slot.free_stack,GUARD_STACK);
+	intptr_t page=slot.start&~(intptr_t)(GUARD_PAGE-1);
+	intptr_t end=slot_base(i)+GUARD_SLOT_SIZE;
+	mprotect((void*)page,end-page,PROT_NONE);
+	madvise((void*)page,end-page,MADV_DONTNEED);
+	unregister_memory(p,slot.size,MEMORY_GUARD);
+
+	std::lock_guard<std::mutex> lock(g_lock);
+	g_free_slots.push_back(i);
+	return true;
+}
+
+void guardalloc_report()
+{
+	if (!g_sample_rate) return;
+	size_t live;
+	{
+		std::lock_guard<std::mutex> lock(g_lock);
+		live=GUARD_SLOTS-g_free_slots.size();
+	}
+	fprintf(stdout,"GuardAlloc: %lu allocations guarded, %zu still live, %lu not guarded because the pool was full\n",
+		g_guarded.load(),live,g_pool_full.load());
+}
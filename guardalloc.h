@@ -0,0 +1,44 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef GUARDALLOC_H
+#define GUARDALLOC_H
+
+#include "main.h"
+
+// Sampling guard-page allocator for AllocatePool and AllocatePages. About one
+// in sample_rate allocations is placed at the end of a slot in a dedicated
+// pool, directly in front of an inaccessible guard page, so that overflowing
+// it faults right away. Freed slots stay inaccessible for as long as possible
+// before they are reused. A fault in the pool is reported with the stacks of
+// the allocation and the free, and then kills the program.
+bool guardalloc_init(unsigned long sample_rate);
+
+// Returns NULL if the allocation isn't sampled (or the pool is full), in which
+// case the caller allocates as usual. Stores its stack for fault reports.
+void* guardalloc_alloc(size_t size,owner_id owner);
+
+// Frees p if it came from guardalloc_alloc and returns whether it did. The
+// memory is relabelled as MEMORY_GUARD instead of MEMORY_HEAP. owner is the
+// image freeing it, for fault reports.
+bool guardalloc_free(void* p,owner_id owner);
+
+void guardalloc_report();
+
+#endif //GUARDALLOC_H
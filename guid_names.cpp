@@ -0,0 +1,101 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+extern "C" {
+#include "efi_guid.h"
+}
+
+// Name index built from g_guid_names on first use. After start-up it is only
+// read, so lookups may happen from any thread. load_guid_database should be
+// called before any images run.
+static guid_table<const char*>& guid_names()
+{
+	static guid_table<const char*> index=[]{
+		guid_table<const char*> t;
+		for (guid_name* p=g_guid_names;p->guid;p++)
+			t.emplace(*p->guid,p->name);
+		return t;
+	}();
+	return index;
+}
+
+char* guid_string_r(EFI_GUID* guid,char* buf,size_t len)
+{
+	const char** name=guid_names().find(*guid);
+	if (name)
+		snprintf(buf,len,"GUID:%s",*name);
+	else
+		snprintf(buf,len,"%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x",guid->Data1,guid->Data2,guid->Data3,guid->Data4[0],guid->Data4[1],guid->Data4[2],guid->Data4[3],guid->Data4[4],guid->Data4[5],guid->Data4[6],guid->Data4[7]);
+	return buf;
+}
+
+const char* guid_string(EFI_GUID* guid)
+{
+	static thread_local char str[64];
+	return guid_string_r(guid,str,sizeof(str));
+}
+
+// Parses a registry-format GUID at the start of str.
+// @returns The number of characters consumed, or 0 if there is no GUID.
+int parse_guid(const char* str,EFI_GUID* guid)
+{
+	unsigned int d[11];
+	int n=0;
+	if (11!=sscanf(str,"%8x-%4x-%4x-%2x%2x-%2x%2x%2x%2x%2x%2x%n",&d[0],&d[1],&d[2],&d[3],&d[4],&d[5],&d[6],&d[7],&d[8],&d[9],&d[10],&n)) return 0;
+	guid->Data1=d[0];
+	guid->Data2=d[1];
+	guid->Data3=d[2];
+	for (int i=0;i<8;i++) guid->Data4[i]=d[3+i];
+	return n;
+}
+
+// One entry per line: a registry-format GUID followed by a comma or
+// whitespace and the name, as in UEFITool's guids.csv. Lines starting with #
+// are ignored. Names from the file replace built-in names for the same GUID.
+bool load_guid_database(const char* filename)
+{
+	FILE* fp=fopen(filename,"r");
+	if (!fp)
+	{
+		fprintf(stderr,"Unable to open GUID database %s\n",filename);
+		return false;
+	}
+	char line[512];
+	int loaded=0;
+	while (fgets(line,sizeof(line),fp))
+	{
+		EFI_GUID guid;
+		if (line[0]=='#') continue;
+		int n=parse_guid(line,&guid);
+		if (!n) continue;
+		char* name=line+n;
+		name+=strspn(name,", \t");
+		name[strcspn(name,"\r\n")]=0;
+		if (!*name) continue;
+		guid_names()[guid]=strdup(name);
+		loaded++;
+	}
+	fclose(fp);
+	fprintf(stdout,"Loaded %d GUID names from %s\n",loaded,filename);
+	return true;
+}
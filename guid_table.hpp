@@ -0,0 +1,187 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef GUID_TABLE_H
+#define GUID_TABLE_H
+
+#include <emmintrin.h>
+#include <string.h>
+#include <efi.h>
+
+#include <utility>
+#include <vector>
+
+inline size_t guid_hash(EFI_GUID const& guid)
+{
+	UINT64 lo,hi;
+	memcpy(&lo,&guid,8);
+	memcpy(&hi,8+(char*)&guid,8);
+	// murmur3 finalizer over both halves, so that GUIDs differing only in
+	// "mirrored" bytes do not collide like they would with lo^hi
+	UINT64 h=lo^(hi*0x9e3779b97f4a7c15ULL);
+	h^=h>>33;
+	h*=0xff51afd7ed558ccdULL;
+	h^=h>>33;
+	h*=0xc4ceb9fe1a85ec53ULL;
+	h^=h>>33;
+	return h;
+}
+
+/// A flat open-addressing hash table keyed by EFI_GUID. Keys are stored
+/// inline next to their value and compared with a single 128-bit SSE compare
+/// per probe. Uses linear probing and backward-shift deletion, so there are no
+/// tombstones.
+template<typename Value> class guid_table
+{
+	struct slot
+	{
+		__m128i key;
+		bool used;
+		Value value;
+	};
+
+	std::vector<slot> slots;
+	size_t mask=0;
+	size_t count=0;
+
+	static __m128i load_key(EFI_GUID const& guid)
+	{
+		return _mm_loadu_si128((const __m128i*)&guid);
+	}
+
+	static bool key_equal(__m128i a,__m128i b)
+	{
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(a,b))==0xffff;
+	}
+
+	size_t locate(__m128i key,size_t h) const
+	{
+		for (size_t i=h&mask;;i=(i+1)&mask)
+		{
+			if (!slots[i].used || key_equal(slots[i].key,key)) return i;
+		}
+	}
+
+	void grow()
+	{
+		std::vector<slot> old(slots.size() ? slots.size()*2 : 16);
+		old.swap(slots);
+		mask=slots.size()-1;
+		for (auto& s : old)
+		{
+			if (!s.used) continue;
+			size_t i=locate(s.key,guid_hash(*(EFI_GUID*)&s.key));
+			slots[i].key=s.key;
+			slots[i].used=true;
+			slots[i].value=std::move(s.value);
+		}
+	}
+
+public:
+	class iterator
+	{
+		slot* cur;
+		slot* end;
+		void skip() { while (cur!=end && !cur->used) cur++; }
+	public:
+		iterator(slot* c,slot* e) : cur(c), end(e) { skip(); }
+		EFI_GUID const& key() const { return *(EFI_GUID*)&cur->key; }
+		Value& value() const { return cur->value; }
+		iterator& operator++() { cur++; skip(); return *this; }
+		bool operator!=(iterator const& o) const { return cur!=o.cur; }
+		iterator& operator*() { return *this; }
+	};
+
+	iterator begin() { return iterator(slots.data(),slots.data()+slots.size()); }
+	iterator end() { return iterator(slots.data()+slots.size(),slots.data()+slots.size()); }
+
+	/// @returns A pointer to the value stored for guid, or NULL.
+	Value* find(EFI_GUID const& guid)
+	{
+		if (!count) return NULL;
+		size_t i=locate(load_key(guid),guid_hash(guid));
+		return slots[i].used ? &slots[i].value : NULL;
+	}
+
+	Value const* find(EFI_GUID const& guid) const
+	{
+		return const_cast<guid_table*>(this)->find(guid);
+	}
+
+	/// Inserts a value if guid is not present yet.
+	/// @returns The stored value and whether an insertion took place.
+	std::pair<Value*,bool> emplace(EFI_GUID const& guid,Value v)
+	{
+		if ((count+1)*4>slots.size()*3) grow();
+		__m128i key=load_key(guid);
+		size_t i=locate(key,guid_hash(guid));
+		if (slots[i].used) return std::make_pair(&slots[i].value,false);
+		slots[i].key=key;
+		slots[i].used=true;
+		slots[i].value=std::move(v);
+		count++;
+		return std::make_pair(&slots[i].value,true);
+	}
+
+	Value& operator[](EFI_GUID const& guid)
+	{
+		return *emplace(guid,Value()).first;
+	}
+
+	bool erase(EFI_GUID const& guid)
+	{
+		if (!count) return false;
+		size_t i=locate(load_key(guid),guid_hash(guid));
+		if (!slots[i].used) return false;
+		// shift back any following entries that were displaced past i
+		for (size_t j=(i+1)&mask;slots[j].used;j=(j+1)&mask)
+		{
+			size_t home=guid_hash(*(EFI_GUID*)&slots[j].key)&mask;
+			if (((j-home)&mask)>=((j-i)&mask))
+			{
+				slots[i].key=slots[j].key;
+				slots[i].value=std::move(slots[j].value);
+				i=j;
+			}
+		}
+		slots[i].used=false;
+		slots[i].value=Value();
+		count--;
+		return true;
+	}
+
+	size_t size() const
+	{
+		return count;
+	}
+
+	bool empty() const
+	{
+		return count==0;
+	}
+
+	void clear()
+	{
+		slots.clear();
+		mask=0;
+		count=0;
+	}
+};
+
+#endif //GUID_TABLE_H
@@ -21,15 +21,17 @@
 #define MAIN_H
 
 #include <efi.h>
+#include <signal.h>
 #include <functional>
+#include "guid_table.hpp"
 
 namespace std
 {
 	template<> struct hash<EFI_GUID>
 	{
-		constexpr size_t operator()(EFI_GUID const& s) const
+		size_t operator()(EFI_GUID const& s) const
 		{
-			return ((UINT64*)&s)[0]^((UINT64*)&s)[1];
+			return guid_hash(s);
 		}
 	};
 }
@@ -39,22 +41,66 @@ constexpr bool operator==(EFI_GUID const& s1, EFI_GUID const& s2)
 	return ((UINT64*)&s1)[0]==((UINT64*)&s2)[0] && ((UINT64*)&s1)[1]==((UINT64*)&s2)[1];
 }
 
-const char* find_pe_caller_id();
+// Pass a stub's __builtin_return_address(0) as return_address; when it lies in
+// an image, that image is the caller and no other lookup is needed.
+const char* find_pe_caller_id(void* return_address=NULL);
+UINT32 find_pe_caller(void* return_address=NULL); // owner_id of find_pe_caller_id, 0 if none
+UINT32 find_pe_image(void* address,void** image_base); // owner_id of the image containing address
 const char* guid_string(EFI_GUID* guid);
+char* guid_string_r(EFI_GUID* guid,char* buf,size_t len);
+int parse_guid(const char* str,EFI_GUID* guid);
+bool load_guid_database(const char* filename);
 void log_protocol(const char* type,EFI_GUID* guid);
 void* find_protocol(EFI_GUID* guid,EFI_HANDLE handle);
 void install_protocol(EFI_GUID* guid,EFI_HANDLE handle,void* interface);
 intptr_t count_handles(EFI_GUID* guid);
+void set_concurrent_registry(bool enable);
+unsigned long protocol_generation(); // changes on every install
+void print_protocol_cache_stats();
+void print_allocation_stats();
 void* get_variable(EFI_GUID* guid,CHAR16* name,UINTN* data_size,UINT32* attributes);
+
+// For signal handlers that don't handle a signal themselves: passes it on to
+// the handler that was installed before, or restores the default action so
+// that the faulting instruction kills the process when it is restarted.
+void chain_signal(const struct sigaction& prev,int sig,siginfo_t* info,void* ctx);
 void set_variable(EFI_GUID* guid,const CHAR16* name,void* data,UINTN data_size,UINT32 attributes);
 void char16_print(const char* prefix, CHAR16* str);
 void* get_smst();
 
-#include <string>
 #include "vast/util/range_map.hpp"
+#include "vast/util/flat_range_map.hpp"
 using vast::util::range_map;
+using vast::util::flat_range_map;
+
+// Owner labels are interned once, ranges only carry the 32-bit ID plus what
+// kind of memory it is. ID 0 means no particular owner.
+typedef UINT32 owner_id;
 
-extern range_map<intptr_t,std::string> g_memory_map;
+enum memory_kind : UINT8
+{
+	MEMORY_OTHER, // labelled with the owner name only
+	MEMORY_POOL,
+	MEMORY_PAGES,
+	MEMORY_IMAGE_MMAP,
+	MEMORY_IMAGE_BASE,
+	MEMORY_STACK,
+	MEMORY_STACK_GUARD,
+	MEMORY_HEAP,
+	MEMORY_NVRAM,
+	MEMORY_PROTOCOL,
+	MEMORY_GUARD, // guardalloc pool, see guardalloc.h
+};
+#define MEMORY_KIND_COUNT (MEMORY_GUARD+1)
+
+struct memory_owner
+{
+	owner_id owner;
+	memory_kind kind;
+	bool operator==(memory_owner const& o) const { return owner==o.owner && kind==o.kind; }
+};
+
+extern flat_range_map<intptr_t,memory_owner> g_memory_map; // empty in concurrent mode
 
 struct memory_block
 {
@@ -63,10 +109,42 @@ struct memory_block
 		size_t size;
 		size_t offset;
 	};
-	std::string name;
+	owner_id owner;
+	memory_kind kind;
 };
 
+owner_id intern_owner(const char* name); // never fails, returns 0 for NULL
+const char* owner_name(owner_id owner); // stays valid forever
+size_t owner_count(); // IDs are 0..owner_count()-1
+const char* memory_kind_name(memory_kind kind);
+const char* memory_label(const memory_block& block); // per-thread buffer
+char* memory_label_r(const memory_block& block,char* buf,size_t len);
 void register_memory(const memory_block& block); // use size member
+void unregister_memory(void* start,size_t size,memory_kind kind=MEMORY_HEAP); // relabel as unowned
 memory_block lookup_memory(void* address); // use offset member
+memory_block lookup_memory_range(void* address); // use size member
+size_t memory_map_size(); // number of ranges
+void for_each_memory_range(const std::function<void(intptr_t,intptr_t,memory_owner)>& fn); // in address order
+void set_concurrent_memory_map(bool enable);
+bool memory_covered(void* base,size_t len); // all of [base,base+len) registered
+void print_memory_cache_stats();
+
+// Calls from efiperun into image code (entry points, event notifications)
+// are wrapped in a pe_call_scope naming the image, so that find_pe_caller
+// only has to read the innermost scope if it has no return address in an
+// image. Outside of any scope, or in a scope for code that isn't in an image,
+// it walks the stack instead. Scopes nest through the saved value and are per
+// thread; the scheduler switches them along with each coroutine.
+class pe_call_scope
+{
+	owner_id saved;
+public:
+	explicit pe_call_scope(owner_id image);
+	~pe_call_scope();
+	pe_call_scope(const pe_call_scope&)=delete;
+	pe_call_scope& operator=(const pe_call_scope&)=delete;
+};
+owner_id current_pe_image(); // innermost pe_call_scope, 0 if none
+void set_current_pe_image(owner_id image);
 
 #endif //MAIN_H
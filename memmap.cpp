@@ -0,0 +1,211 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+using std::unordered_map;
+using std::vector;
+
+#include "main.h"
+#include "memmap.h"
+#include "events.h"
+#include "variables.h"
+#include "efi_guid.h"
+
+/* The map itself is a flat_range_map from page-aligned addresses to memory
+ * types, which merges neighbouring pages of the same type as they are
+ * inserted, so it always holds exactly the coalesced descriptors. The map
+ * key counts changes to it. GetMemoryMap only converts the map into an array
+ * of descriptors when the key changed since the last call, which is the
+ * common case of callers that retry with a bigger buffer or ask again right
+ * before ExitBootServices.
+ */
+
+#define EFI_PAGE 4096
+#define NO_TYPE ((UINT32)-1)
+
+struct page_use
+{
+	UINT32 count; // live allocations on the page
+	UINT32 below; // type before the first of them, or NO_TYPE
+};
+
+static std::mutex g_memmap_lock;
+static flat_range_map<UINT64,UINT32> g_memmap;
+static unordered_map<UINT64,page_use> g_page_use;
+static UINTN g_map_key=1;
+static UINTN g_built_key=0;
+static vector<EFI_MEMORY_DESCRIPTOR> g_descriptors;
+
+static UINT64 page_floor(void* p)
+{
+	return (UINT64)(intptr_t)p&~(UINT64)(EFI_PAGE-1);
+}
+
+static UINT64 page_ceil(void* p,size_t size)
+{
+	return ((UINT64)(intptr_t)p+size+EFI_PAGE-1)&~(UINT64)(EFI_PAGE-1);
+}
+
+static void set_type_locked(UINT64 l,UINT64 r,UINT32 type)
+{
+	if (r<=l) return;
+	auto cur=g_memmap.find(l);
+	if (type!=NO_TYPE && std::get<2>(cur) && *std::get<2>(cur)==type && std::get<1>(cur)>=r) return;
+	g_memmap.erase(l,r);
+	if (type!=NO_TYPE) g_memmap.inject(l,r,type);
+	g_map_key++;
+}
+
+static UINT32 type_of_locked(UINT64 page)
+{
+	const UINT32* type=g_memmap.lookup(page);
+	return type ? *type : NO_TYPE;
+}
+
+// Consecutive pages that change to the same type are set in one go.
+struct page_run
+{
+	UINT64 l,r;
+	UINT32 type;
+
+	page_run() : l(0),r(0),type(NO_TYPE) {}
+	void add(UINT64 page,UINT32 t)
+	{
+		if (r==page && type==t && r>l)
+		{
+			r+=EFI_PAGE;
+			return;
+		}
+		flush();
+		l=page;
+		r=page+EFI_PAGE;
+		type=t;
+	}
+	void flush()
+	{
+		set_type_locked(l,r,type);
+		l=r=0;
+	}
+};
+
+void memmap_add(void* start,size_t size,EFI_MEMORY_TYPE type)
+{
+	std::lock_guard<std::mutex> lock(g_memmap_lock);
+	set_type_locked(page_floor(start),page_ceil(start,size),type);
+}
+
+void memmap_allocate(void* start,size_t size,EFI_MEMORY_TYPE type)
+{
+	std::lock_guard<std::mutex> lock(g_memmap_lock);
+	page_run run;
+	for (UINT64 p=page_floor(start);p<page_ceil(start,std::max<size_t>(size,1));p+=EFI_PAGE)
+	{
+		page_use& use=g_page_use[p];
+		if (use.count++) continue; // keeps the type of the first allocation
+		use.below=type_of_locked(p);
+		run.add(p,type);
+	}
+	run.flush();
+}
+
+void memmap_free(void* start,size_t size)
+{
+	std::lock_guard<std::mutex> lock(g_memmap_lock);
+	page_run run;
+	for (UINT64 p=page_floor(start);p<page_ceil(start,std::max<size_t>(size,1));p+=EFI_PAGE)
+	{
+		auto it=g_page_use.find(p);
+		if (it==g_page_use.end() || --it->second.count) continue;
+		run.add(p,it->second.below);
+		g_page_use.erase(it);
+	}
+	run.flush();
+}
+
+static UINT64 type_attributes(UINT32 type)
+{
+	switch (type)
+	{
+		case EfiRuntimeServicesCode:
+		case EfiRuntimeServicesData:
+			return EFI_MEMORY_WB|EFI_MEMORY_RUNTIME;
+		case EfiMemoryMappedIO:
+		case EfiMemoryMappedIOPortSpace:
+			return EFI_MEMORY_UC|EFI_MEMORY_RUNTIME;
+		default:
+			return EFI_MEMORY_WB;
+	}
+}
+
+EFI_STATUS EFIAPI GetMemoryMap(IN OUT UINTN *MemoryMapSize, IN OUT EFI_MEMORY_DESCRIPTOR *MemoryMap, OUT UINTN *MapKey, OUT UINTN *DescriptorSize, OUT UINT32 *DescriptorVersion)
+{
+	if (MemoryMapSize==NULL) return EFI_INVALID_PARAMETER;
+
+	std::lock_guard<std::mutex> lock(g_memmap_lock);
+	if (g_built_key!=g_map_key)
+	{
+		size_t n=g_memmap.size();
+		const UINT64* lefts=g_memmap.lefts();
+		const UINT64* rights=g_memmap.rights();
+		const UINT32* types=g_memmap.values();
+		g_descriptors.resize(n);
+		for (size_t i=0;i<n;i++)
+			g_descriptors[i]={types[i],0,lefts[i],lefts[i],(rights[i]-lefts[i])/EFI_PAGE,type_attributes(types[i])};
+		g_built_key=g_map_key;
+	}
+
+	UINTN size=g_descriptors.size()*sizeof(EFI_MEMORY_DESCRIPTOR);
+	if (DescriptorSize) *DescriptorSize=sizeof(EFI_MEMORY_DESCRIPTOR);
+	if (DescriptorVersion) *DescriptorVersion=EFI_MEMORY_DESCRIPTOR_VERSION;
+	fprintf(stdout,"GetMemoryMap\n  size=%lx, needed=%lx, key=%lx\n",*MemoryMapSize,size,g_map_key);
+	if (*MemoryMapSize<size)
+	{
+		*MemoryMapSize=size;
+		return EFI_BUFFER_TOO_SMALL;
+	}
+	if (MemoryMap==NULL) return EFI_INVALID_PARAMETER;
+	memcpy(MemoryMap,g_descriptors.data(),size);
+	*MemoryMapSize=size;
+	if (MapKey) *MapKey=g_map_key;
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS EFIAPI ExitBootServices(IN EFI_HANDLE ImageHandle, IN UINTN MapKey)
+{
+	{
+		std::lock_guard<std::mutex> lock(g_memmap_lock);
+		if (MapKey!=g_map_key)
+		{
+			fprintf(stdout,"ExitBootServices\n  stale key=%lx, current key=%lx\n",MapKey,g_map_key);
+			return EFI_INVALID_PARAMETER;
+		}
+	}
+	fprintf(stdout,"ExitBootServices\n  key=%lx\n",MapKey);
+	signal_event_group(&gEfiEventExitBootServicesGuid);
+	variables_enter_runtime();
+
+	return EFI_SUCCESS;
+}
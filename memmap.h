@@ -0,0 +1,37 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef MEMMAP_H
+#define MEMMAP_H
+
+#include <efi.h>
+
+EFI_STATUS EFIAPI GetMemoryMap(IN OUT UINTN *MemoryMapSize, IN OUT EFI_MEMORY_DESCRIPTOR *MemoryMap, OUT UINTN *MapKey, OUT UINTN *DescriptorSize, OUT UINT32 *DescriptorVersion);
+EFI_STATUS EFIAPI ExitBootServices(IN EFI_HANDLE ImageHandle, IN UINTN MapKey);
+
+// The EFI memory map is kept per page. memmap_add types whole regions such
+// as images, stacks and heap chunks. memmap_allocate types the pages touched
+// by an allocation; since several allocations can share a page, pages are
+// reference counted and get their previous type back in memmap_free once the
+// last allocation on them is gone.
+void memmap_add(void* start,size_t size,EFI_MEMORY_TYPE type);
+void memmap_allocate(void* start,size_t size,EFI_MEMORY_TYPE type);
+void memmap_free(void* start,size_t size);
+
+#endif //MEMMAP_H
@@ -0,0 +1,457 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+using std::map;
+using std::string;
+using std::tuple;
+using std::vector;
+
+#include "main.h"
+#include "memtrace.h"
+
+/* Everything the signal handlers touch is in our own .bss or in the glibc
+ * heap, and neither may ever be protected. The memory map does label some
+ * glibc heap objects (dummy protocols and their hook trampolines, static
+ * protocol interfaces), so only guest memory is traced: ranges owned by
+ * efiperun are never selected, and a page is only armed if all of it lies in
+ * guest memory (heap chunks, images, stacks, NVRAM). Disarming restores the
+ * protection a page had when it was armed, read from /proc/self/maps. The
+ * handlers don't allocate, and they run on an alternate stack so that tracing
+ * the stack itself works.
+ */
+
+#define TRACE_PAGE 4096
+#define MAX_RECORDS 65536 // power of two
+#define MAX_PROBES 64
+#define MAX_STEPPING 4 // pages unprotected for a single instruction
+#define ALTSTACK_SIZE (64*1024)
+#define EFLAGS_TF 0x100
+#define PF_WRITE 0x2
+#define PF_INSTR 0x10
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+extern char etext,end; // efiperun's own data lies in between
+
+struct trace_region
+{
+	intptr_t start,end;
+	owner_id owner;
+	memory_kind kind;
+	unsigned long reads,writes;
+};
+
+struct trace_page
+{
+	intptr_t addr;
+	int prot; // protection while not armed
+	bool armed;
+};
+
+struct trace_record
+{
+	intptr_t pc; // an RVA if image is set
+	intptr_t offset; // into the region
+	UINT32 region;
+	owner_id image; // 0 for efiperun itself
+	UINT32 write;
+	unsigned long count; // 0 for unused slots
+};
+
+static bool g_enabled=false;
+static vector<string> g_spec;
+static unsigned long g_sample_usec=0;
+static timer_t g_timer;
+
+static vector<trace_region> g_regions; // every region ever traced, for the report
+static map<tuple<intptr_t,intptr_t,owner_id,memory_kind>,UINT32> g_region_index;
+static vector<UINT32> g_active; // sorted indices into g_regions of the traced ones
+static vector<trace_page> g_pages; // sorted
+static vector<size_t> g_disarmed; // pages to protect again on the next sample tick
+static size_t g_ndisarmed=0;
+static trace_record g_records[MAX_RECORDS];
+static unsigned long g_dropped=0;
+
+static struct sigaction g_prev_sigsegv;
+static struct sigaction g_prev_sigtrap;
+static thread_local size_t t_stepping[MAX_STEPPING];
+static thread_local int t_nstepping=0;
+
+static trace_page* find_page(intptr_t addr)
+{
+	addr&=~(intptr_t)(TRACE_PAGE-1);
+	auto it=std::lower_bound(g_pages.begin(),g_pages.end(),addr,[](trace_page const& p,intptr_t a) { return p.addr<a; });
+	return it!=g_pages.end() && it->addr==addr ? &*it : NULL;
+}
+
+static trace_region* find_region(intptr_t addr)
+{
+	auto it=std::upper_bound(g_active.begin(),g_active.end(),addr,[](intptr_t a,UINT32 i) { return a<g_regions[i].start; });
+	if (it==g_active.begin()) return NULL;
+	trace_region* region=&g_regions[*(it-1)];
+	return addr<region->end ? region : NULL;
+}
+
+static void record(intptr_t addr,intptr_t pc,bool write)
+{
+	trace_region* region=find_region(addr);
+	if (!region) return; // the page is shared with something that isn't traced
+	(write ? region->writes : region->reads)++;
+
+	void* base;
+	owner_id image=find_pe_image((void*)pc,&base);
+	if (image) pc-=(intptr_t)base;
+	trace_record key={pc,addr-region->start,(UINT32)(region-g_regions.data()),image,write,1};
+
+	UINT64 h=(UINT64)key.pc*0x9e3779b97f4a7c15ULL;
+	h^=(key.offset+((UINT64)key.region<<32))*0xc4ceb9fe1a85ec53ULL;
+	h^=((UINT64)key.image<<1|key.write)*0xff51afd7ed558ccdULL;
+	h^=h>>29;
+	for (size_t i=0;i<MAX_PROBES;i++)
+	{
+		trace_record& slot=g_records[(h+i)&(MAX_RECORDS-1)];
+		if (!slot.count)
+		{
+			slot=key;
+			return;
+		}
+		if (slot.pc==key.pc && slot.offset==key.offset && slot.region==key.region && slot.image==key.image && slot.write==key.write)
+		{
+			slot.count++;
+			return;
+		}
+	}
+	g_dropped++;
+}
+
+static void trace_sigsegv(int sig,siginfo_t* info,void* ctx)
+{
+	trace_page* page=NULL;
+	if (info->si_code==SEGV_ACCERR && t_nstepping<MAX_STEPPING) page=find_page((intptr_t)info->si_addr);
+	if (!page || !page->armed) return chain_signal(g_prev_sigsegv,sig,info,ctx);
+
+	ucontext_t* uc=(ucontext_t*)ctx;
+	greg_t* regs=uc->uc_mcontext.gregs;
+	if (!(regs[REG_ERR]&PF_INSTR)) record((intptr_t)info->si_addr,regs[REG_RIP],regs[REG_ERR]&PF_WRITE);
+
+	mprotect((void*)page->addr,TRACE_PAGE,page->prot);
+	page->armed=false;
+	t_stepping[t_nstepping++]=page-g_pages.data();
+	regs[REG_EFL]|=EFLAGS_TF;
+	// a sample tick must not protect the page again before the instruction ran
+	sigaddset(&uc->uc_sigmask,SIGPROF);
+}
+
+static void trace_sigtrap(int sig,siginfo_t* info,void* ctx)
+{
+	if (!t_nstepping) return chain_signal(g_prev_sigtrap,sig,info,ctx);
+
+	for (int i=0;i<t_nstepping;i++)
+	{
+		if (g_sample_usec)
+		{
+			g_disarmed[g_ndisarmed++]=t_stepping[i];
+			continue;
+		}
+		trace_page& page=g_pages[t_stepping[i]];
+		if (!mprotect((void*)page.addr,TRACE_PAGE,PROT_NONE)) page.armed=true;
+	}
+	t_nstepping=0;
+	ucontext_t* uc=(ucontext_t*)ctx;
+	uc->uc_mcontext.gregs[REG_EFL]&=~EFLAGS_TF;
+	sigdelset(&uc->uc_sigmask,SIGPROF);
+}
+
+static void trace_sigprof(int sig)
+{
+	while (g_ndisarmed)
+	{
+		trace_page& page=g_pages[g_disarmed[--g_ndisarmed]];
+		if (!mprotect((void*)page.addr,TRACE_PAGE,PROT_NONE)) page.armed=true;
+	}
+}
+
+// Memory that images allocate, run from or run on, as opposed to efiperun's
+// own objects and the guard pages
+static bool guest_memory(memory_kind kind)
+{
+	switch (kind)
+	{
+		case MEMORY_POOL:
+		case MEMORY_PAGES:
+		case MEMORY_IMAGE_MMAP:
+		case MEMORY_IMAGE_BASE:
+		case MEMORY_STACK:
+		case MEMORY_HEAP:
+		case MEMORY_NVRAM:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static bool selected(memory_owner const& o)
+{
+	if (!guest_memory(o.kind)) return false;
+	for (auto& s : g_spec)
+	{
+		if (s==memory_kind_name(o.kind) || (o.owner && s==owner_name(o.owner))) return true;
+	}
+	return false;
+}
+
+struct mapping
+{
+	intptr_t start,end;
+	int prot;
+};
+
+// The current protection of every mapping, sorted by address
+static vector<mapping> read_mappings()
+{
+	vector<mapping> maps;
+	FILE* fp=fopen("/proc/self/maps","r");
+	if (!fp) return maps;
+	unsigned long start,end;
+	char perms[5];
+	while (3==fscanf(fp,"%lx-%lx %4s%*[^\n]",&start,&end,perms))
+	{
+		int prot=(perms[0]=='r' ? PROT_READ : 0)|(perms[1]=='w' ? PROT_WRITE : 0)|(perms[2]=='x' ? PROT_EXEC : 0);
+		maps.push_back({(intptr_t)start,(intptr_t)end,prot});
+	}
+	fclose(fp);
+	return maps;
+}
+
+// Finds the interval in sorted, disjoint intervals that contains [l,r)
+template<typename T> static T const* containing(vector<T> const& v,intptr_t l,intptr_t r)
+{
+	auto it=std::upper_bound(v.begin(),v.end(),l,[](intptr_t a,T const& m) { return a<m.start; });
+	if (it==v.begin()) return NULL;
+	--it;
+	return r<=it->end ? &*it : NULL;
+}
+
+static UINT32 region_index(intptr_t l,intptr_t r,memory_owner const& o)
+{
+	auto it=g_region_index.emplace(std::make_tuple(l,r,o.owner,o.kind),(UINT32)g_regions.size());
+	if (it.second) g_regions.push_back({l,r,o.owner,o.kind,0,0});
+	return it.first->second;
+}
+
+static void block_sigprof(bool block)
+{
+	sigset_t set;
+	sigemptyset(&set);
+	sigaddset(&set,SIGPROF);
+	sigprocmask(block ? SIG_BLOCK : SIG_UNBLOCK,&set,NULL);
+}
+
+static void disarm_all()
+{
+	for (auto& page : g_pages)
+	{
+		if (page.armed) mprotect((void*)page.addr,TRACE_PAGE,page.prot);
+		page.armed=false;
+	}
+	g_ndisarmed=0;
+}
+
+bool memtrace_init(const char* spec,unsigned long sample_usec)
+{
+	for (const char* p=spec;*p;)
+	{
+		const char* comma=strchrnul(p,',');
+		if (comma>p) g_spec.push_back(string(p,comma-p));
+		p=*comma ? comma+1 : comma;
+	}
+	if (g_spec.empty())
+	{
+		fprintf(stderr,"Nothing to trace: %s\n",spec);
+		return false;
+	}
+
+	stack_t ss;
+	ss.ss_sp=mmap(NULL,ALTSTACK_SIZE,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+	ss.ss_size=ALTSTACK_SIZE;
+	ss.ss_flags=0;
+	if (ss.ss_sp==MAP_FAILED || sigaltstack(&ss,NULL))
+	{
+		perror("sigaltstack");
+		return false;
+	}
+
+	struct sigaction sa;
+	memset(&sa,0,sizeof(sa));
+	sa.sa_flags=SA_SIGINFO|SA_ONSTACK;
+	sigemptyset(&sa.sa_mask);
+	sigaddset(&sa.sa_mask,SIGPROF);
+	sa.sa_sigaction=trace_sigsegv;
+	sigaction(SIGSEGV,&sa,&g_prev_sigsegv);
+	sa.sa_sigaction=trace_sigtrap;
+	sigaction(SIGTRAP,&sa,&g_prev_sigtrap);
+
+	g_sample_usec=sample_usec;
+	if (g_sample_usec)
+	{
+		sa.sa_flags=SA_ONSTACK|SA_RESTART;
+		sa.sa_handler=trace_sigprof;
+		sigaction(SIGPROF,&sa,NULL);
+
+		// ticks on this thread's CPU time, so it also lands on this thread
+		struct sigevent sev;
+		memset(&sev,0,sizeof(sev));
+		sev.sigev_notify=SIGEV_THREAD_ID;
+		sev.sigev_signo=SIGPROF;
+		sev.sigev_notify_thread_id=syscall(SYS_gettid);
+		struct itimerspec its;
+		its.it_interval.tv_sec=g_sample_usec/1000000;
+		its.it_interval.tv_nsec=(g_sample_usec%1000000)*1000;
+		its.it_value=its.it_interval;
+		if (timer_create(CLOCK_THREAD_CPUTIME_ID,&sev,&g_timer) || timer_settime(g_timer,0,&its,NULL))
+		{
+			perror("timer_create");
+			return false;
+		}
+	}
+	g_enabled=true;
+	return true;
+}
+
+void memtrace_arm()
+{
+	if (!g_enabled) return;
+	block_sigprof(true);
+	disarm_all();
+
+	g_active.clear();
+	g_pages.clear();
+	// contiguous stretches of guest memory, and the ranges to trace
+	vector<mapping> guest;
+	vector<tuple<intptr_t,intptr_t,memory_owner>> ranges;
+	for_each_memory_range([&](intptr_t l,intptr_t r,memory_owner o)
+	{
+		if (!guest_memory(o.kind)) return;
+		if (!guest.empty() && guest.back().end==l)
+			guest.back().end=r;
+		else
+			guest.push_back({l,r,0});
+		if (selected(o)) ranges.emplace_back(l,r,o);
+	});
+	vector<mapping> maps=read_mappings();
+
+	for (auto& range : ranges)
+	{
+		intptr_t l=std::get<0>(range),r=std::get<1>(range);
+		memory_owner o=std::get<2>(range);
+		size_t regions=g_regions.size();
+		g_active.push_back(region_index(l,r,o));
+		bool skipped=false;
+		for (intptr_t p=l&~(intptr_t)(TRACE_PAGE-1);p<r;p+=TRACE_PAGE)
+		{
+			if (!containing(guest,p,p+TRACE_PAGE) || (p+TRACE_PAGE>(intptr_t)&etext && p<(intptr_t)&end))
+			{
+				skipped=true;
+				continue;
+			}
+			// unmapped pages, e.g. the unused part of the stack, are left out
+			mapping const* m=containing(maps,p,p+TRACE_PAGE);
+			if (m) g_pages.push_back({p,m->prot,false});
+		}
+		if (skipped && regions!=g_regions.size())
+			fprintf(stdout,"memtrace: not tracing all of %s, it shares pages with efiperun's own memory\n",memory_label({(void*)l,0,o.owner,o.kind}));
+	}
+
+	// ranges can share a page
+	std::sort(g_pages.begin(),g_pages.end(),[](trace_page const& a,trace_page const& b) { return a.addr<b.addr; });
+	g_pages.erase(std::unique(g_pages.begin(),g_pages.end(),[](trace_page const& a,trace_page const& b) { return a.addr==b.addr; }),g_pages.end());
+	g_disarmed.resize(g_pages.size());
+
+	for (auto& page : g_pages)
+	{
+		if (!mprotect((void*)page.addr,TRACE_PAGE,PROT_NONE)) page.armed=true;
+	}
+	block_sigprof(false);
+}
+
+void memtrace_report()
+{
+	if (!g_enabled) return;
+	block_sigprof(true);
+	disarm_all();
+	if (g_sample_usec) timer_delete(g_timer);
+	g_enabled=false;
+	block_sigprof(false);
+
+	vector<trace_record*> records;
+	for (auto& r : g_records)
+	{
+		if (r.count) records.push_back(&r);
+	}
+	std::sort(records.begin(),records.end(),[](trace_record* a,trace_record* b)
+	{
+		return a->region!=b->region ? a->region<b->region : a->count>b->count;
+	});
+
+	if (g_sample_usec)
+		fprintf(stdout,"Memory access trace (sampled every %luus of CPU time):\n",g_sample_usec);
+	else
+		fprintf(stdout,"Memory access trace:\n");
+	auto rec=records.begin();
+	for (size_t i=0;i<g_regions.size();i++)
+	{
+		trace_region& region=g_regions[i];
+		if (!region.reads && !region.writes) continue;
+		fprintf(stdout,"  %s [%016lx-%016lx): %lu reads, %lu writes\n",memory_label({(void*)region.start,0,region.owner,region.kind}),
+			region.start,region.end,region.reads,region.writes);
+		int shown=0;
+		for (;rec!=records.end() && (*rec)->region==i;rec++)
+		{
+			if (shown++==16)
+			{
+				fprintf(stdout,"    ...\n");
+				while (rec!=records.end() && (*rec)->region==i) rec++;
+				break;
+			}
+			char by[128];
+			if ((*rec)->image)
+				snprintf(by,sizeof(by),"%s+%lx",owner_name((*rec)->image),(*rec)->pc);
+			else
+				snprintf(by,sizeof(by),"efiperun@%016lx",(*rec)->pc);
+			fprintf(stdout,"    %-40s %c +%08lx %8lu\n",by,(*rec)->write ? 'W' : 'R',(*rec)->offset,(*rec)->count);
+		}
+	}
+	if (g_dropped) fprintf(stdout,"  %lu accesses were not itemized, the record table was full\n",g_dropped);
+}
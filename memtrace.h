@@ -0,0 +1,39 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef MEMTRACE_H
+#define MEMTRACE_H
+
+// Records which images read and write which tracked memory ranges, using page
+// protection. spec is a comma-separated list of memory kinds (e.g. POOL,
+// JEMALLOC_HEAP, STACK) and owner names (e.g. Foo.efi); the matching ranges
+// of g_memory_map are protected, every fault is recorded and the instruction
+// is single-stepped before the page is protected again. With a non-zero
+// sample interval, a page is only protected again once per interval of CPU
+// time, which bounds the overhead on hot pages.
+bool memtrace_init(const char* spec,unsigned long sample_usec);
+
+// (Re)selects the ranges to trace. Called whenever an image is started, so
+// that its own ranges are included.
+void memtrace_arm();
+
+// Stops tracing and prints a per-range summary.
+void memtrace_report();
+
+#endif //MEMTRACE_H
@@ -0,0 +1,443 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using std::atomic;
+using std::vector;
+
+#include "main.h"
+#include "epoch.hpp"
+
+flat_range_map<intptr_t,memory_owner> g_memory_map;
+// Bumped before and after every change to the map, so that a coverage
+// computed from the old map while it changes is never cached under the
+// version that holds once the change is done.
+static atomic<unsigned long> g_memory_version{1};
+static atomic<unsigned long> g_coverage_hits{0};
+static atomic<unsigned long> g_coverage_misses{0};
+
+/* Owner names
+ *
+ * Names live in fixed chunks that never move, so owner_name doesn't need a
+ * lock, and are never freed, so the pointers it hands out stay valid.
+ */
+#define OWNER_CHUNK_BITS 10
+#define OWNER_CHUNKS 1024
+
+static atomic<const char**> g_owner_chunks[OWNER_CHUNKS];
+static atomic<size_t> g_owner_count{0};
+static std::unordered_map<std::string,owner_id> g_owner_ids;
+static std::mutex g_owner_lock;
+
+owner_id intern_owner(const char* name)
+{
+	if (!name) return 0;
+	std::lock_guard<std::mutex> lock(g_owner_lock);
+	if (g_owner_ids.empty()) g_owner_ids.emplace("",0);
+	auto it=g_owner_ids.emplace(name,g_owner_ids.size());
+	if (!it.second) return it.first->second;
+	owner_id id=it.first->second;
+	size_t chunk=id>>OWNER_CHUNK_BITS;
+	if (chunk>=OWNER_CHUNKS)
+	{
+		fprintf(stderr,"More than %d memory owners\nAborted\n",OWNER_CHUNKS<<OWNER_CHUNK_BITS);
+		_exit(0);
+	}
+	if (!g_owner_chunks[chunk].load(std::memory_order_relaxed))
+		g_owner_chunks[chunk].store(new const char*[1<<OWNER_CHUNK_BITS](),std::memory_order_release);
+	g_owner_chunks[chunk].load(std::memory_order_relaxed)[id&((1<<OWNER_CHUNK_BITS)-1)]=strdup(name);
+	g_owner_count.store(id+1,std::memory_order_release);
+	return id;
+}
+
+const char* owner_name(owner_id owner)
+{
+	if (!owner || owner>=g_owner_count.load(std::memory_order_acquire)) return "";
+	return g_owner_chunks[owner>>OWNER_CHUNK_BITS].load(std::memory_order_acquire)[owner&((1<<OWNER_CHUNK_BITS)-1)];
+}
+
+size_t owner_count()
+{
+	return std::max<size_t>(g_owner_count.load(std::memory_order_acquire),1);
+}
+
+const char* memory_kind_name(memory_kind kind)
+{
+	switch (kind)
+	{
+		case MEMORY_OTHER: return "";
+		case MEMORY_POOL: return "POOL";
+		case MEMORY_PAGES: return "PAGES";
+		case MEMORY_IMAGE_MMAP: return "IMAGE_MMAP";
+		case MEMORY_IMAGE_BASE: return "IMAGE_BASE";
+		case MEMORY_STACK: return "STACK";
+		case MEMORY_STACK_GUARD: return "STACK_GUARD";
+		case MEMORY_HEAP: return "JEMALLOC_HEAP";
+		case MEMORY_NVRAM: return "NVRAM";
+		case MEMORY_PROTOCOL: return "PROTOCOL";
+		case MEMORY_GUARD: return "GUARD";
+	}
+	return "?";
+}
+
+// "owner::KIND", or just one of them if the other is empty
+char* memory_label_r(const memory_block& block,char* buf,size_t len)
+{
+	const char* owner=owner_name(block.owner);
+	const char* kind=memory_kind_name(block.kind);
+	snprintf(buf,len,"%s%s%s",owner,*owner && *kind ? "::" : "",kind);
+	return buf;
+}
+
+const char* memory_label(const memory_block& block)
+{
+	static thread_local char str[256];
+	return memory_label_r(block,str,sizeof(str));
+}
+
+/* Concurrent mode
+ *
+ * The address space is cut into 4MiB granules, the size and alignment of
+ * jemalloc's chunks, and each granule belongs to one of MEMORY_SHARDS shards
+ * by its low bits. A range that fits in one granule is kept in that granule's
+ * shard; the few that span several (images, stacks, huge allocations) go to
+ * an extra shard of their own. Threads allocating from different chunks thus
+ * mostly update different shards.
+ *
+ * Writers serialize per shard with a mutex and bump the shard's sequence
+ * number around every change. Readers don't lock: they read the published
+ * arrays and retry if the sequence number changed meanwhile. The arrays are
+ * allocated with epoch_allocator, so an array that a reader may still be
+ * looking at is only freed once the reader left its epoch_guard.
+ */
+#define GRANULE_SHIFT 22
+#define MEMORY_SHARDS 64
+#define LARGE_SHARD MEMORY_SHARDS
+
+template<typename T> struct epoch_allocator
+{
+	typedef T value_type;
+	epoch_allocator() {}
+	template<typename U> epoch_allocator(const epoch_allocator<U>&) {}
+	T* allocate(size_t n) { return (T*)::operator new(n*sizeof(T)); }
+	void deallocate(T* p,size_t) { epoch_retire(p,[](void* q){ ::operator delete(q); }); }
+	template<typename U> bool operator==(const epoch_allocator<U>&) const { return true; }
+	template<typename U> bool operator!=(const epoch_allocator<U>&) const { return false; }
+};
+
+struct alignas(64) memory_shard
+{
+	std::mutex lock;
+	atomic<unsigned long> seq{0}; // odd while the map is being changed
+	// the map's arrays as of the last change, for readers
+	atomic<const intptr_t*> lefts{NULL};
+	atomic<const intptr_t*> rights{NULL};
+	atomic<const memory_owner*> values{NULL};
+	atomic<size_t> size{0};
+	flat_range_map<intptr_t,memory_owner,epoch_allocator> map;
+
+	void begin_write()
+	{
+		seq.store(seq.load(std::memory_order_relaxed)+1,std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+
+	void end_write()
+	{
+		lefts.store(map.lefts(),std::memory_order_relaxed);
+		rights.store(map.rights(),std::memory_order_relaxed);
+		values.store(map.values(),std::memory_order_relaxed);
+		size.store(map.size(),std::memory_order_release);
+		seq.store(seq.load(std::memory_order_relaxed)+1,std::memory_order_release);
+	}
+
+	// Lock-free search. Calls fn(lefts,rights,values,n) until it ran without a
+	// concurrent change and returns its result. Call inside an epoch_guard.
+	// The size is read first: buffers only grow, so arrays published later
+	// hold at least that many elements.
+	template<typename Fn> bool read(Fn fn)
+	{
+		for (;;)
+		{
+			unsigned long s=seq.load(std::memory_order_acquire);
+			if (s&1) continue;
+			size_t n=size.load(std::memory_order_acquire);
+			bool ret=fn(lefts.load(std::memory_order_relaxed),rights.load(std::memory_order_relaxed),values.load(std::memory_order_relaxed),n);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (seq.load(std::memory_order_relaxed)==s) return ret;
+		}
+	}
+
+	bool find(intptr_t p,intptr_t& l,intptr_t& r,memory_owner& o)
+	{
+		return read([&](const intptr_t* ls,const intptr_t* rs,const memory_owner* vs,size_t n)
+		{
+			size_t i=flat_range_map<intptr_t,memory_owner>::locate(ls,rs,n,p);
+			if (i==flat_range_map<intptr_t,memory_owner>::npos) return false;
+			l=ls[i];
+			r=rs[i];
+			o=vs[i];
+			return true;
+		});
+	}
+
+	// Whether any range overlaps [l,r)
+	bool overlaps(intptr_t l,intptr_t r)
+	{
+		return read([&](const intptr_t* ls,const intptr_t* rs,const memory_owner*,size_t n)
+		{
+			size_t i=std::lower_bound(ls,ls+n,r)-ls; // ranges before i start before r
+			return i>0 && rs[i-1]>l;
+		});
+	}
+};
+
+static bool g_concurrent=false;
+static memory_shard g_shards[MEMORY_SHARDS+1];
+
+static size_t shard_of(intptr_t l,intptr_t r)
+{
+	if ((l>>GRANULE_SHIFT)!=((r-1)>>GRANULE_SHIFT)) return LARGE_SHARD;
+	return (l>>GRANULE_SHIFT)&(MEMORY_SHARDS-1);
+}
+
+// Calls fn(shard) for every small-range shard that may hold part of [l,r).
+template<typename Fn> static void for_each_shard(intptr_t l,intptr_t r,Fn fn)
+{
+	intptr_t first=l>>GRANULE_SHIFT;
+	intptr_t last=(r-1)>>GRANULE_SHIFT;
+	if (last-first>=MEMORY_SHARDS-1)
+	{
+		for (size_t i=0;i<MEMORY_SHARDS;i++) fn(g_shards[i]);
+		return;
+	}
+	for (intptr_t g=first;g<=last;g++) fn(g_shards[g&(MEMORY_SHARDS-1)]);
+}
+
+// Removes [l,r) everywhere and stores it in its own shard.
+static void shard_replace(intptr_t l,intptr_t r,memory_owner o,bool merge)
+{
+	for_each_shard(l,r,[&](memory_shard& shard)
+	{
+		std::lock_guard<std::mutex> lock(shard.lock);
+		shard.begin_write();
+		shard.map.erase(l,r);
+		shard.end_write();
+	});
+	memory_shard& large=g_shards[LARGE_SHARD];
+	bool overlaps;
+	{
+		epoch_guard guard;
+		overlaps=large.overlaps(l,r);
+	}
+	if (overlaps)
+	{
+		std::lock_guard<std::mutex> lock(large.lock);
+		large.begin_write();
+		large.map.erase(l,r);
+		large.end_write();
+	}
+	memory_shard& shard=g_shards[shard_of(l,r)];
+	std::lock_guard<std::mutex> lock(shard.lock);
+	shard.begin_write();
+	if (merge)
+		shard.map.inject(l,r,o);
+	else
+		shard.map.insert(l,r,o);
+	shard.end_write();
+}
+
+static bool shard_find(intptr_t p,intptr_t& l,intptr_t& r,memory_owner& o)
+{
+	epoch_guard guard;
+	return g_shards[(p>>GRANULE_SHIFT)&(MEMORY_SHARDS-1)].find(p,l,r,o) || g_shards[LARGE_SHARD].find(p,l,r,o);
+}
+
+void set_concurrent_memory_map(bool enable)
+{
+	if (enable==g_concurrent) return;
+	g_memory_version++;
+	if (enable)
+	{
+		// move over anything registered so far
+		for (auto range : g_memory_map)
+			shard_replace(std::get<0>(range),std::get<1>(range),std::get<2>(range),false);
+		g_memory_map.clear();
+	}
+	else
+	{
+		for_each_memory_range([](intptr_t l,intptr_t r,memory_owner o) { g_memory_map.insert(l,r,o); });
+		for (auto& shard : g_shards)
+		{
+			std::lock_guard<std::mutex> lock(shard.lock);
+			shard.begin_write();
+			shard.map.clear();
+			shard.end_write();
+		}
+	}
+	g_concurrent=enable;
+	g_memory_version++;
+}
+
+void register_memory(const memory_block& block)
+{
+	intptr_t l=(intptr_t)block.start;
+	intptr_t r=block.size+(intptr_t)block.start;
+	g_memory_version.fetch_add(1,std::memory_order_relaxed);
+	if (g_concurrent)
+	{
+		if (r>l) shard_replace(l,r,{block.owner,block.kind},false);
+	}
+	else
+	{
+		g_memory_map.erase(l,r);
+		g_memory_map.insert(l,r,{block.owner,block.kind});
+	}
+	g_memory_version.fetch_add(1,std::memory_order_release);
+}
+
+void unregister_memory(void* start,size_t size,memory_kind kind)
+{
+	intptr_t l=(intptr_t)start;
+	intptr_t r=size+(intptr_t)start;
+	g_memory_version.fetch_add(1,std::memory_order_relaxed);
+	// hand it back to the surrounding heap chunk (or guard pool) so the map
+	// doesn't fragment
+	if (g_concurrent)
+	{
+		if (r>l) shard_replace(l,r,{0,kind},true);
+	}
+	else
+	{
+		g_memory_map.erase(l,r);
+		g_memory_map.inject(l,r,{0,kind});
+	}
+	g_memory_version.fetch_add(1,std::memory_order_release);
+}
+
+static bool find_range(intptr_t p,intptr_t& l,intptr_t& r,memory_owner& o)
+{
+	if (g_concurrent) return shard_find(p,l,r,o);
+	auto map=g_memory_map.find(p);
+	if (!std::get<2>(map)) return false;
+	l=std::get<0>(map);
+	r=std::get<1>(map);
+	o=*std::get<2>(map);
+	return true;
+}
+
+memory_block lookup_memory(void* address)
+{
+	intptr_t l,r;
+	memory_owner o;
+	if (find_range((intptr_t)address,l,r,o)) return {(void*)l,(size_t)((intptr_t)address-l),o.owner,o.kind};
+	return {NULL,0,0,MEMORY_OTHER};
+}
+
+memory_block lookup_memory_range(void* address)
+{
+	intptr_t l,r;
+	memory_owner o;
+	if (find_range((intptr_t)address,l,r,o)) return {(void*)l,(size_t)(r-l),o.owner,o.kind};
+	return {NULL,0,0,MEMORY_OTHER};
+}
+
+size_t memory_map_size()
+{
+	if (!g_concurrent) return g_memory_map.size();
+	size_t n=0;
+	for (auto& shard : g_shards) n+=shard.size.load(std::memory_order_relaxed);
+	return n;
+}
+
+void for_each_memory_range(const std::function<void(intptr_t,intptr_t,memory_owner)>& fn)
+{
+	if (!g_concurrent)
+	{
+		for (auto range : g_memory_map) fn(std::get<0>(range),std::get<1>(range),std::get<2>(range));
+		return;
+	}
+	struct range
+	{
+		intptr_t l,r;
+		memory_owner o;
+	};
+	vector<range> ranges;
+	for (auto& shard : g_shards)
+	{
+		std::lock_guard<std::mutex> lock(shard.lock);
+		for (auto r : shard.map) ranges.push_back({std::get<0>(r),std::get<1>(r),std::get<2>(r)});
+	}
+	std::sort(ranges.begin(),ranges.end(),[](range const& a,range const& b) { return a.l<b.l; });
+	for (auto& r : ranges) fn(r.l,r.r,r.o);
+}
+
+// Stretch of contiguous ranges starting with the one containing lo, up to hi
+static std::pair<intptr_t,intptr_t> coverage(intptr_t lo,intptr_t hi)
+{
+	if (!g_concurrent) return g_memory_map.coverage(lo,hi);
+	intptr_t l,r,first;
+	memory_owner o;
+	if (!shard_find(lo,l,r,o)) return {lo,lo};
+	first=l;
+	while (r<hi && shard_find(r,l,r,o));
+	return {first,r};
+}
+
+// CopyMem and friends tend to hit the same buffer over and over, so remember
+// the last contiguously covered stretch until the map changes.
+bool memory_covered(void* base,size_t len)
+{
+	static thread_local struct
+	{
+		intptr_t lo,hi;
+		unsigned long version;
+	} last={0,0,0};
+	intptr_t lo=(intptr_t)base;
+	intptr_t hi=len+(intptr_t)base;
+
+	unsigned long version=g_memory_version.load(std::memory_order_acquire);
+	if (last.version==version && last.lo<=lo && lo<last.hi && hi<=last.hi)
+	{
+		g_coverage_hits.fetch_add(1,std::memory_order_relaxed);
+		return true;
+	}
+	g_coverage_misses.fetch_add(1,std::memory_order_relaxed);
+	auto c=coverage(lo,hi);
+	if (c.second<=lo || c.second<hi) return false;
+	last={c.first,c.second,version};
+	return true;
+}
+
+void print_memory_cache_stats()
+{
+	unsigned long hits=g_coverage_hits.load();
+	unsigned long misses=g_coverage_misses.load();
+	if (hits+misses)
+		fprintf(stdout,"Memory coverage cache: %lu hits, %lu misses (%.1f%% hit rate)\n",hits,misses,100.0*hits/(hits+misses));
+}
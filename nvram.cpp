@@ -0,0 +1,206 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <string>
+
+#include "main.h"
+#include "variables.h"
+extern "C" {
+#include "efi_guid.h"
+}
+
+// Variable store formats as defined by EDK2's VariableFormat.h
+
+#define VARIABLE_STORE_FORMATTED 0x5a
+#define VARIABLE_STORE_HEALTHY   0xfe
+#define VSS_SIGNATURE            0x53535624 // '$VSS'
+#define VARIABLE_DATA            0x55aa
+#define VAR_ADDED                0x3f
+#define VAR_IN_DELETED_TRANSITION 0xfe
+#define HEADER_ALIGNMENT         4
+
+#pragma pack(push,1)
+typedef struct {
+	EFI_GUID Signature;
+	UINT32 Size;
+	UINT8 Format;
+	UINT8 State;
+	UINT16 Reserved;
+	UINT32 Reserved1;
+} VARIABLE_STORE_HEADER;
+
+typedef struct {
+	UINT32 Signature;
+	UINT32 Size;
+	UINT8 Format;
+	UINT8 State;
+	UINT16 Reserved;
+	UINT32 Reserved1;
+} VSS_VARIABLE_STORE_HEADER;
+
+typedef struct {
+	UINT16 StartId;
+	UINT8 State;
+	UINT8 Reserved;
+	UINT32 Attributes;
+	UINT32 NameSize;
+	UINT32 DataSize;
+	EFI_GUID VendorGuid;
+} VARIABLE_HEADER;
+
+typedef struct {
+	UINT16 StartId;
+	UINT8 State;
+	UINT8 Reserved;
+	UINT32 Attributes;
+	UINT64 MonotonicCount;
+	EFI_TIME TimeStamp;
+	UINT32 PubKeyIndex;
+	UINT32 NameSize;
+	UINT32 DataSize;
+	EFI_GUID VendorGuid;
+} AUTHENTICATED_VARIABLE_HEADER;
+#pragma pack(pop)
+
+static size_t header_align(size_t offset)
+{
+	return (offset+HEADER_ALIGNMENT-1)&~(size_t)(HEADER_ALIGNMENT-1);
+}
+
+// Indexes the variables of one store in place.
+// @returns The number of variables imported.
+static int import_store(const char* base,size_t start,size_t end,bool authenticated)
+{
+	int count=0;
+	size_t offset=header_align(start);
+	size_t header_size=authenticated ? sizeof(AUTHENTICATED_VARIABLE_HEADER) : sizeof(VARIABLE_HEADER);
+	while (offset+header_size<=end)
+	{
+		const VARIABLE_HEADER* header=(const VARIABLE_HEADER*)(base+offset);
+		if (header->StartId!=VARIABLE_DATA) break;
+
+		UINT32 name_size,data_size;
+		const EFI_GUID* guid;
+		if (authenticated)
+		{
+			const AUTHENTICATED_VARIABLE_HEADER* auth=(const AUTHENTICATED_VARIABLE_HEADER*)header;
+			name_size=auth->NameSize;
+			data_size=auth->DataSize;
+			guid=&auth->VendorGuid;
+		}
+		else
+		{
+			name_size=header->NameSize;
+			data_size=header->DataSize;
+			guid=&header->VendorGuid;
+		}
+		size_t name_offset=offset+header_size;
+		if (name_size>end-name_offset || data_size>end-name_offset-name_size) break;
+		const CHAR16* name=(const CHAR16*)(base+name_offset);
+		const void* data=base+name_offset+name_size;
+
+		// A variable that is in deleted transition is still valid, unless
+		// its replacement was written completely.
+		UINT8 state=header->State;
+		bool valid_name=name_size>=sizeof(CHAR16) && !(name_size%sizeof(CHAR16)) && name[name_size/sizeof(CHAR16)-1]==0;
+		if (valid_name && (state==VAR_ADDED || state==(VAR_ADDED&VAR_IN_DELETED_TRANSITION)))
+		{
+			import_variable(*guid,name,data,data_size,header->Attributes,state==VAR_ADDED);
+			count++;
+		}
+		offset=header_align(name_offset+name_size+data_size);
+	}
+	return count;
+}
+
+bool import_nvram(const char* filename)
+{
+	int fd=open(filename,O_RDONLY);
+	if (fd==-1)
+	{
+		fprintf(stderr,"Unable to open NVRAM image %s\n",filename);
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd,&st) || !st.st_size)
+	{
+		fprintf(stderr,"Unable to read NVRAM image %s\n",filename);
+		close(fd);
+		return false;
+	}
+	size_t size=st.st_size;
+	// Stays mapped for the rest of the run, since imported variables point
+	// into it. Pages are only read in for the variables that are used.
+	const char* base=(const char*)mmap(NULL,size,PROT_READ,MAP_PRIVATE,fd,0);
+	close(fd);
+	if (base==MAP_FAILED)
+	{
+		perror("import_nvram: mmap");
+		return false;
+	}
+	register_memory({(void*)base,size,intern_owner(filename),MEMORY_NVRAM});
+
+	// Stores are found anywhere in a full ROM image, but their headers are
+	// at least 4-byte aligned.
+	int stores=0,variables=0;
+	for (size_t offset=0;offset+sizeof(VARIABLE_STORE_HEADER)<=size;offset+=HEADER_ALIGNMENT)
+	{
+		const VARIABLE_STORE_HEADER* store=(const VARIABLE_STORE_HEADER*)(base+offset);
+		size_t header_size;
+		bool authenticated=false;
+		if (!memcmp(&store->Signature,&gEfiAuthenticatedVariableGuid,sizeof(EFI_GUID)))
+		{
+			authenticated=true;
+			header_size=sizeof(VARIABLE_STORE_HEADER);
+		}
+		else if (!memcmp(&store->Signature,&gEfiVariableGuid,sizeof(EFI_GUID)))
+		{
+			header_size=sizeof(VARIABLE_STORE_HEADER);
+		}
+		else if (*(const UINT32*)store==VSS_SIGNATURE)
+		{
+			header_size=sizeof(VSS_VARIABLE_STORE_HEADER);
+		}
+		else
+		{
+			continue;
+		}
+
+		// both header forms end in the same size, format and state fields
+		const VSS_VARIABLE_STORE_HEADER* tail=(const VSS_VARIABLE_STORE_HEADER*)((const char*)store+header_size-sizeof(VSS_VARIABLE_STORE_HEADER));
+		if (tail->Format!=VARIABLE_STORE_FORMATTED || tail->State!=VARIABLE_STORE_HEALTHY) continue;
+		if (tail->Size<header_size || tail->Size>size-offset) continue;
+
+		int n=import_store(base,offset+header_size,offset+tail->Size,authenticated);
+		fprintf(stdout,"NVRAM store at %08lx: %d variables%s\n",offset,n,authenticated ? " (authenticated)" : "");
+		stores++;
+		variables+=n;
+		offset+=tail->Size-HEADER_ALIGNMENT;
+	}
+	fprintf(stdout,"Imported %d variables from %d stores in %s\n",variables,stores,filename);
+
+	return stores!=0;
+}
@@ -0,0 +1,182 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+#include "main.h"
+#include "events.h"
+#include "memmap.h"
+#include "scheduler.h"
+#include "vclock.h"
+
+#define STACK_SIZE (512*1024)
+#define GUARD_SIZE 4096
+
+struct coroutine
+{
+	const char* name;
+	void (*fn)(void*);
+	void* arg;
+	ucontext_t context;
+	EFI_TPL tpl;
+	owner_id image; // its current_pe_image while switched out
+	UINT64 wake_time;               // 0 when runnable
+	unsigned long wake_generation;  // g_wake_generation when it went to sleep
+	bool done;
+};
+
+static vector<coroutine*> g_coroutines;
+static coroutine* g_current=NULL;
+static ucontext_t g_scheduler_context;
+// Bumped on every signal. Other threads may signal events too, hence atomic.
+static std::atomic<unsigned long> g_wake_generation(0);
+
+static void coroutine_main()
+{
+	coroutine* co=g_current;
+	co->fn(co->arg);
+	co->done=true;
+	// returning resumes g_scheduler_context through uc_link
+}
+
+void sched_spawn(const char* name,void (*fn)(void*),void* arg)
+{
+	// Stacks are never unmapped, so that their memory map labels stay
+	// accurate. Pages that were never touched are not committed.
+	char* p=(char*)mmap(NULL,GUARD_SIZE+STACK_SIZE,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE|MAP_STACK,-1,0);
+	if (p==MAP_FAILED)
+	{
+		perror("sched_spawn: mmap");
+		abort();
+	}
+	mprotect(p,GUARD_SIZE,PROT_NONE);
+	owner_id owner=intern_owner(name);
+	register_memory({p,GUARD_SIZE,owner,MEMORY_STACK_GUARD});
+	register_memory({p+GUARD_SIZE,STACK_SIZE,owner,MEMORY_STACK});
+	memmap_add(p,GUARD_SIZE+STACK_SIZE,EfiBootServicesData);
+
+	coroutine* co=new coroutine();
+	co->name=name;
+	co->fn=fn;
+	co->arg=arg;
+	co->tpl=TPL_APPLICATION;
+	getcontext(&co->context);
+	co->context.uc_stack.ss_sp=p+GUARD_SIZE;
+	co->context.uc_stack.ss_size=STACK_SIZE;
+	co->context.uc_link=&g_scheduler_context;
+	makecontext(&co->context,coroutine_main,0);
+	g_coroutines.push_back(co);
+}
+
+bool sched_active()
+{
+	return g_current!=NULL;
+}
+
+void sched_wait_until(UINT64 deadline)
+{
+	coroutine* co=g_current;
+	co->wake_time=deadline ? deadline : 1;
+	co->wake_generation=g_wake_generation.load();
+	swapcontext(&co->context,&g_scheduler_context);
+	co->wake_time=0;
+}
+
+void sched_wake_waiters()
+{
+	g_wake_generation++;
+}
+
+static bool runnable(coroutine* co,UINT64 now,unsigned long generation)
+{
+	return co->wake_time<=now || co->wake_generation!=generation;
+}
+
+// Switches to co until it yields or finishes. Each coroutine has its own TPL
+// and image scope.
+static void resume(coroutine* co)
+{
+	EFI_TPL tpl=current_tpl();
+	owner_id image=current_pe_image();
+	set_current_tpl(co->tpl);
+	set_current_pe_image(co->image);
+	g_current=co;
+	swapcontext(&g_scheduler_context,&co->context);
+	g_current=NULL;
+	co->tpl=current_tpl();
+	co->image=current_pe_image();
+	set_current_tpl(tpl);
+	set_current_pe_image(image);
+}
+
+void sched_run()
+{
+	size_t next=0;
+	while (!g_coroutines.empty())
+	{
+		// round-robin over runnable coroutines
+		UINT64 now=vclock_now();
+		unsigned long generation=g_wake_generation.load();
+		UINT64 earliest=~0ULL;
+		size_t n=g_coroutines.size(),i;
+		for (i=0;i<n;i++)
+		{
+			coroutine* co=g_coroutines[(next+i)%n];
+			if (runnable(co,now,generation)) break;
+			earliest=std::min(earliest,co->wake_time);
+		}
+
+		if (i==n)
+		{
+			if (earliest==~0ULL)
+			{
+				fprintf(stdout,"Scheduler: %zu images are blocked with no timers armed:\n",n);
+				for (auto co : g_coroutines) fprintf(stdout,"  %s\n",co->name);
+				return;
+			}
+			vclock_sleep_until(earliest);
+			continue;
+		}
+
+		size_t index=(next+i)%n;
+		coroutine* co=g_coroutines[index];
+		resume(co);
+		if (co->done)
+		{
+			g_coroutines.erase(g_coroutines.begin()+index);
+			delete co;
+			next=index;
+		}
+		else
+		{
+			next=index+1;
+		}
+		if (next>=g_coroutines.size()) next=0;
+	}
+}
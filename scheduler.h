@@ -0,0 +1,45 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <efi.h>
+
+// Cooperative scheduler that runs images as coroutines on the main thread.
+// Blocking services yield to the next runnable coroutine instead of sleeping.
+
+// Creates a coroutine that will run fn(arg) on its own stack. name is used to
+// label the stack in the memory map and must stay valid.
+void sched_spawn(const char* name,void (*fn)(void*),void* arg);
+
+// Runs coroutines until all of them have finished or are blocked for good.
+void sched_run();
+
+// Whether the caller is running inside a coroutine.
+bool sched_active();
+
+// Yields until deadline (in virtual time) has passed or an event is
+// signalled. Pass ~0ULL to wait for a signal only.
+void sched_wait_until(UINT64 deadline);
+
+// Makes all coroutines waiting in sched_wait_until runnable again.
+void sched_wake_waiters();
+
+#endif //SCHEDULER_H
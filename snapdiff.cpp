@@ -0,0 +1,291 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+// Compares two memory map snapshots written by efiperun --snapshot, e.g. of
+// a good and a bad run. Addresses differ between runs, so ranges are matched
+// by owner, kind and size: a range at the same address is unchanged, others
+// with the same key are paired up in address order as moved, and the rest
+// were added or removed.
+// Run as: snapdiff [-v] a.snap b.snap
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using std::map;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+#include "snapshot.h"
+
+// A snapshot file mapped into memory
+struct snapshot
+{
+	const snapshot_header* header;
+	const snapshot_range* ranges;
+	const snapshot_image* images;
+	const uint32_t* labels;
+	const char* strings;
+	size_t size;
+};
+
+static bool snapshot_open(const char* filename,snapshot* snap)
+{
+	int fd=open(filename,O_RDONLY);
+	struct stat st;
+	if (fd==-1 || fstat(fd,&st))
+	{
+		perror(filename);
+		if (fd!=-1) close(fd);
+		return false;
+	}
+	snap->size=st.st_size;
+	const char* base=snap->size>=sizeof(snapshot_header) ? (const char*)mmap(NULL,snap->size,PROT_READ,MAP_PRIVATE,fd,0) : (const char*)MAP_FAILED;
+	close(fd);
+	if (base==MAP_FAILED || memcmp(base,SNAPSHOT_MAGIC,8))
+	{
+		fprintf(stderr,"%s is not a snapshot\n",filename);
+		if (base!=MAP_FAILED) munmap((void*)base,snap->size);
+		return false;
+	}
+
+	const snapshot_header* h=(const snapshot_header*)base;
+	uint64_t n_labels=((uint64_t)h->n_owners+h->n_kinds+1)&~(uint64_t)1;
+	uint64_t off=sizeof(snapshot_header);
+	uint64_t ranges=off;
+	off+=(uint64_t)h->n_ranges*sizeof(snapshot_range);
+	uint64_t images=off;
+	off+=(uint64_t)h->n_images*sizeof(snapshot_image);
+	uint64_t labels=off;
+	off+=n_labels*sizeof(uint32_t);
+	uint64_t strings=off;
+	off+=h->string_bytes;
+	bool ok=off<=snap->size && h->string_bytes && !base[strings+h->string_bytes-1];
+	for (uint64_t i=0;ok && i<(uint64_t)h->n_owners+h->n_kinds;i++)
+		ok=((const uint32_t*)(base+labels))[i]<h->string_bytes;
+	if (!ok)
+	{
+		fprintf(stderr,"%s is truncated or corrupt\n",filename);
+		munmap((void*)base,snap->size);
+		return false;
+	}
+	snap->header=h;
+	snap->ranges=(const snapshot_range*)(base+ranges);
+	snap->images=(const snapshot_image*)(base+images);
+	snap->labels=(const uint32_t*)(base+labels);
+	snap->strings=base+strings;
+	return true;
+}
+
+static void snapshot_close(snapshot* snap)
+{
+	munmap((void*)snap->header,snap->size);
+}
+
+// Labels of both snapshots, interned so that keys can be compared as integers
+static vector<string> g_names;
+static unordered_map<string,uint32_t> g_name_index;
+
+static uint32_t intern(const char* name)
+{
+	auto it=g_name_index.emplace(name,g_names.size());
+	if (it.second) g_names.push_back(name);
+	return it.first->second;
+}
+
+struct side
+{
+	snapshot snap;
+	vector<uint32_t> owners; // snapshot owner ID -> interned name
+	vector<uint32_t> kinds;
+
+	void intern_labels()
+	{
+		const snapshot_header* h=snap.header;
+		for (uint32_t i=0;i<h->n_owners;i++) owners.push_back(intern(snap.strings+snap.labels[i]));
+		for (uint32_t i=0;i<h->n_kinds;i++) kinds.push_back(intern(snap.strings+snap.labels[h->n_owners+i]));
+	}
+
+	uint32_t owner(uint32_t id) const { return id<owners.size() ? owners[id] : intern("?"); }
+	uint32_t kind(uint32_t id) const { return id<kinds.size() ? kinds[id] : intern("?"); }
+};
+
+struct range_key
+{
+	uint32_t owner;
+	uint32_t kind;
+	uint64_t size;
+	bool operator==(range_key const& o) const { return owner==o.owner && kind==o.kind && size==o.size; }
+};
+
+struct range_key_hash
+{
+	size_t operator()(range_key const& k) const
+	{
+		uint64_t h=((uint64_t)k.owner<<32|k.kind)*0x9e3779b97f4a7c15ULL;
+		h^=k.size*0xc4ceb9fe1a85ec53ULL;
+		return h^(h>>31);
+	}
+};
+
+// Start addresses per key, for either snapshot. Snapshots are sorted by
+// address, so these are too.
+struct range_starts
+{
+	vector<uint64_t> a,b;
+};
+
+struct owner_changes
+{
+	unsigned long added,removed,moved,unchanged;
+	uint64_t added_bytes,removed_bytes;
+};
+
+static string label(uint32_t owner,uint32_t kind)
+{
+	const string& o=g_names[owner];
+	const string& k=g_names[kind];
+	if (o.empty()) return k;
+	if (k.empty()) return o;
+	return o+"::"+k;
+}
+
+int main(int argc,char** argv)
+{
+	bool verbose=argc>1 && !strcmp(argv[1],"-v");
+	if (argc!=3+verbose)
+	{
+		fprintf(stderr,"Usage: %s [-v] a.snap b.snap\n",argv[0]);
+		return 1;
+	}
+	side sides[2];
+	for (int i=0;i<2;i++)
+	{
+		if (!snapshot_open(argv[1+verbose+i],&sides[i].snap)) return 1;
+		sides[i].intern_labels();
+	}
+
+	unordered_map<range_key,range_starts,range_key_hash> keys;
+	for (int i=0;i<2;i++)
+	{
+		const snapshot& snap=sides[i].snap;
+		for (uint32_t r=0;r<snap.header->n_ranges;r++)
+		{
+			const snapshot_range& range=snap.ranges[r];
+			range_key key={sides[i].owner(range.owner),sides[i].kind(range.kind),range.end-range.start};
+			range_starts& starts=keys[key];
+			(i ? starts.b : starts.a).push_back(range.start);
+		}
+	}
+
+	// ordered by label for the report
+	map<string,owner_changes> changes;
+	for (auto& k : keys)
+	{
+		const range_key& key=k.first;
+		range_starts& starts=k.second;
+		owner_changes& c=changes[label(key.owner,key.kind)];
+		vector<uint64_t> only_a,only_b;
+		size_t i=0,j=0;
+		while (i<starts.a.size() || j<starts.b.size())
+		{
+			if (i<starts.a.size() && j<starts.b.size() && starts.a[i]==starts.b[j])
+			{
+				c.unchanged++;
+				i++;
+				j++;
+			}
+			else if (j==starts.b.size() || (i<starts.a.size() && starts.a[i]<starts.b[j]))
+				only_a.push_back(starts.a[i++]);
+			else
+				only_b.push_back(starts.b[j++]);
+		}
+		size_t moved=std::min(only_a.size(),only_b.size());
+		c.moved+=moved;
+		c.removed+=only_a.size()-moved;
+		c.added+=only_b.size()-moved;
+		c.removed_bytes+=(only_a.size()-moved)*key.size;
+		c.added_bytes+=(only_b.size()-moved)*key.size;
+		if (!verbose) continue;
+		string name=label(key.owner,key.kind);
+		for (size_t m=0;m<only_a.size() || m<only_b.size();m++)
+		{
+			if (m<moved)
+				printf("moved   %-40s %016lx -> %016lx size=%lx\n",name.c_str(),only_a[m],only_b[m],key.size);
+			else if (m<only_a.size())
+				printf("removed %-40s %016lx size=%lx\n",name.c_str(),only_a[m],key.size);
+			else
+				printf("added   %-40s %016lx size=%lx\n",name.c_str(),only_b[m],key.size);
+		}
+	}
+
+	printf("Ranges: %u -> %u\n",sides[0].snap.header->n_ranges,sides[1].snap.header->n_ranges);
+	printf("%-40s %20s %20s %8s %10s\n","owner","added (bytes)","removed (bytes)","moved","unchanged");
+	for (auto& c : changes)
+	{
+		const owner_changes& oc=c.second;
+		if (!oc.added && !oc.removed && !oc.moved) continue;
+		char added[32],removed[32];
+		snprintf(added,sizeof(added),"%lu (%lu)",oc.added,oc.added_bytes);
+		snprintf(removed,sizeof(removed),"%lu (%lu)",oc.removed,oc.removed_bytes);
+		printf("%-40s %20s %20s %8lu %10lu\n",c.first.c_str(),added,removed,oc.moved,oc.unchanged);
+	}
+
+	// images are few, match them by name
+	map<string,const snapshot_image*> images[2];
+	for (int i=0;i<2;i++)
+	{
+		const snapshot& snap=sides[i].snap;
+		for (uint32_t m=0;m<snap.header->n_images;m++)
+			images[i][g_names[sides[i].owner(snap.images[m].owner)]]=&snap.images[m];
+	}
+	bool header=false;
+	for (int i=0;i<2;i++)
+	{
+		for (auto& image : images[i])
+		{
+			auto other=images[!i].find(image.first);
+			const char* change=NULL;
+			if (other==images[!i].end())
+				change=i ? "only in b" : "only in a";
+			else if (!i && (other->second->image_base!=image.second->image_base || other->second->end-other->second->start!=image.second->end-image.second->start))
+				change="moved";
+			if (!change) continue;
+			if (!header) printf("Images:\n");
+			header=true;
+			if (!strcmp(change,"moved"))
+				printf("  %-38s %016lx -> %016lx\n",image.first.c_str(),image.second->image_base,other->second->image_base);
+			else
+				printf("  %-38s %s\n",image.first.c_str(),change);
+		}
+	}
+
+	snapshot_close(&sides[0].snap);
+	snapshot_close(&sides[1].snap);
+	return 0;
+}
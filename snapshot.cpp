@@ -0,0 +1,95 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+using std::pair;
+using std::string;
+using std::vector;
+
+#include "main.h"
+#include "snapshot.h"
+extern "C" {
+#include "peloader.h"
+}
+
+extern flat_range_map<intptr_t,pair<loadinfo,owner_id>> g_pe_map;
+
+static void pad8(string& strings)
+{
+	strings.append((8-strings.size()%8)%8,'\0');
+}
+
+bool snapshot_write(const char* filename)
+{
+	FILE* fp=fopen(filename,"wb");
+	if (!fp)
+	{
+		fprintf(stderr,"Unable to write snapshot %s\n",filename);
+		return false;
+	}
+
+	vector<snapshot_range> ranges;
+	ranges.reserve(memory_map_size());
+	for_each_memory_range([&](intptr_t l,intptr_t r,memory_owner o)
+	{
+		ranges.push_back({(uint64_t)l,(uint64_t)r,o.owner,o.kind});
+	});
+
+	vector<snapshot_image> images;
+	for (auto image : g_pe_map)
+	{
+		auto const& info=std::get<2>(image);
+		images.push_back({(uint64_t)std::get<0>(image),(uint64_t)std::get<1>(image),(uint64_t)info.first.image_base,info.second,0});
+	}
+
+	size_t n_owners=owner_count();
+	vector<uint32_t> labels;
+	string strings;
+	for (size_t i=0;i<n_owners+MEMORY_KIND_COUNT;i++)
+	{
+		labels.push_back(strings.size());
+		strings+=i<n_owners ? owner_name(i) : memory_kind_name((memory_kind)(i-n_owners));
+		strings+='\0';
+	}
+	if (labels.size()%2) labels.push_back(0);
+	pad8(strings);
+
+	snapshot_header header;
+	memcpy(header.magic,SNAPSHOT_MAGIC,sizeof(header.magic));
+	header.n_ranges=ranges.size();
+	header.n_images=images.size();
+	header.n_owners=n_owners;
+	header.n_kinds=MEMORY_KIND_COUNT;
+	header.string_bytes=strings.size();
+	header.reserved=0;
+
+	fwrite(&header,sizeof(header),1,fp);
+	fwrite(ranges.data(),sizeof(snapshot_range),ranges.size(),fp);
+	fwrite(images.data(),sizeof(snapshot_image),images.size(),fp);
+	fwrite(labels.data(),sizeof(uint32_t),labels.size(),fp);
+	fwrite(strings.data(),1,strings.size(),fp);
+	bool ok=!ferror(fp);
+	fclose(fp);
+	return ok;
+}
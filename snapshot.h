@@ -0,0 +1,69 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdint.h>
+
+// Memory map snapshots, as written by --snapshot and read by snapdiff. The
+// file is meant to be mapped and used in place: all integers are
+// little-endian and every array is 8-byte aligned.
+//   snapshot_header   header
+//   snapshot_range    ranges[n_ranges]   g_memory_map, sorted by start
+//   snapshot_image    images[n_images]   g_pe_map, sorted by start
+//   uint32_t          labels[n_owners+n_kinds], padded to an even count
+//                     offsets into strings; owner i is labels[i], memory
+//                     kind k is labels[n_owners+k]
+//   char              strings[string_bytes]   NUL-terminated, padded to 8
+#define SNAPSHOT_MAGIC "EPRSNAP1"
+
+struct snapshot_header
+{
+	char magic[8];
+	uint32_t n_ranges;
+	uint32_t n_images;
+	uint32_t n_owners;
+	uint32_t n_kinds;
+	uint32_t string_bytes;
+	uint32_t reserved;
+};
+
+struct snapshot_range
+{
+	uint64_t start;
+	uint64_t end;
+	uint32_t owner;
+	uint32_t kind;
+};
+
+struct snapshot_image
+{
+	uint64_t start;
+	uint64_t end;
+	uint64_t image_base;
+	uint32_t owner;
+	uint32_t reserved;
+};
+
+// Writes the current g_memory_map and g_pe_map. See snapdiff.cpp for the
+// reader.
+bool snapshot_write(const char* filename);
+
+#endif //SNAPSHOT_H
@@ -18,13 +18,16 @@
  */
 
 #include <stdio.h>
-#include <x86intrin.h>
+#include <time.h>
 #include <cross-stdarg.h>
 #include <unistd.h>
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
 #include <vector>
 #include <string>
+using std::atomic;
 using std::vector;
 using std::string;
 
@@ -32,6 +35,11 @@ using std::string;
 
 #include "main.h"
 #include "stubs.h"
+#include "arenas.h"
+#include "depgraph.h"
+#include "guardalloc.h"
+#include "memmap.h"
+#include "vclock.h"
 
 // NOTE: This is *NOT* for access control. If the PE module wanted to access a 
 // certain memory address, it could just do so. This is only a debugging aid.
@@ -45,19 +53,53 @@ using std::string;
 // 1. Tables, interfaces, etc. preloaded by this program
 static bool can_access(void* base, size_t len)
 {
-	intptr_t lo=((intptr_t)base);
-	intptr_t hi=(len+(intptr_t)base);
-	
-	for (auto range=g_memory_map.find(lo);std::get<2>(range);range=g_memory_map.find(lo))
+	return memory_covered(base,len);
+}
+
+// Drivers tend to look up the same protocol from the same place over and
+// over. Remember the result per (call site, GUID, handle) until the next
+// install changes protocol_generation().
+#define PROTOCOL_CACHE_SIZE 256
+
+struct protocol_cache_entry
+{
+	void* caller;
+	EFI_GUID guid;
+	EFI_HANDLE handle;
+	unsigned long generation;
+	void* interface;
+};
+
+static thread_local protocol_cache_entry t_protocol_cache[PROTOCOL_CACHE_SIZE];
+static atomic<unsigned long> g_protocol_cache_hits(0);
+static atomic<unsigned long> g_protocol_cache_misses(0);
+
+static void* cached_find_protocol(void* caller,EFI_GUID* guid,EFI_HANDLE handle)
+{
+	unsigned long generation=protocol_generation();
+	auto& entry=t_protocol_cache[(((intptr_t)caller>>2)^guid->Data1^(intptr_t)handle)%PROTOCOL_CACHE_SIZE];
+	if (entry.interface && entry.generation==generation && entry.caller==caller && entry.handle==handle && entry.guid==*guid)
 	{
-		if (hi<=std::get<1>(range)) return true;
-		lo=std::get<1>(range);
+		g_protocol_cache_hits.fetch_add(1,std::memory_order_relaxed);
+		return entry.interface;
 	}
-	
-	return false;
+	g_protocol_cache_misses.fetch_add(1,std::memory_order_relaxed);
+	// a hit implies the same call site, so the edge is already recorded
+	depgraph_consume(caller,guid);
+	void* interface=find_protocol(guid,handle);
+	entry={caller,*guid,handle,generation,interface};
+	return interface;
 }
 
-EFI_STATUS EFIAPI HandleProtocol(IN EFI_HANDLE Handle,IN EFI_GUID *Protocol,OUT VOID **Interface)
+void print_protocol_cache_stats()
+{
+	unsigned long hits=g_protocol_cache_hits.load();
+	unsigned long misses=g_protocol_cache_misses.load();
+	if (hits+misses)
+		fprintf(stdout,"Protocol lookup cache: %lu hits, %lu misses (%.1f%% hit rate)\n",hits,misses,100.0*hits/(hits+misses));
+}
+
+static EFI_STATUS handle_protocol(void* caller,EFI_HANDLE Handle,EFI_GUID *Protocol,VOID **Interface)
 {
 	if (Protocol==NULL) return EFI_INVALID_PARAMETER;
 	
@@ -65,17 +107,22 @@ EFI_STATUS EFIAPI HandleProtocol(IN EFI_HANDLE Handle,IN EFI_GUID *Protocol,OUT
 	
 	if (Interface==NULL) return EFI_INVALID_PARAMETER;
 	
-	*Interface=find_protocol(Protocol,Handle);
+	*Interface=cached_find_protocol(caller,Protocol,Handle);
 
 	return EFI_SUCCESS;
 }
 
+EFI_STATUS EFIAPI HandleProtocol(IN EFI_HANDLE Handle,IN EFI_GUID *Protocol,OUT VOID **Interface)
+{
+	return handle_protocol(__builtin_return_address(0),Handle,Protocol,Interface);
+}
+
 EFI_STATUS EFIAPI LocateProtocol(IN EFI_GUID *Protocol,IN VOID *Registration OPTIONAL,OUT VOID **Interface)
 {
-	return HandleProtocol(NULL,Protocol,Interface);
+	return handle_protocol(__builtin_return_address(0),NULL,Protocol,Interface);
 }
 
-EFI_STATUS EFIAPI InstallProtocolInterface(IN OUT EFI_HANDLE *Handle, IN EFI_GUID *Protocol, IN EFI_INTERFACE_TYPE InterfaceType, IN VOID *Interface)
+static EFI_STATUS install_protocol_interface(void* caller,EFI_HANDLE *Handle,EFI_GUID *Protocol,EFI_INTERFACE_TYPE InterfaceType,VOID *Interface)
 {
 	if (InterfaceType!=EFI_NATIVE_INTERFACE) return EFI_INVALID_PARAMETER;
 	if (!Protocol) return EFI_INVALID_PARAMETER;
@@ -83,15 +130,21 @@ EFI_STATUS EFIAPI InstallProtocolInterface(IN OUT EFI_HANDLE *Handle, IN EFI_GUI
 	
 	log_protocol("Install",Protocol);
 	install_protocol(Protocol,*Handle,Interface);
+	depgraph_produce(caller,Protocol);
 	const memory_block& block=lookup_memory(Interface);
 	if (block.start)
-		fprintf(stdout,"  @offset %s+%08lx\n",block.name.c_str(),block.offset);
+		fprintf(stdout,"  @offset %s+%08lx\n",memory_label(block),block.offset);
 	else
 		fprintf(stdout,"  @address %016lx\n",(intptr_t)Interface);
 
 	return EFI_SUCCESS;
 }
 
+EFI_STATUS EFIAPI InstallProtocolInterface(IN OUT EFI_HANDLE *Handle, IN EFI_GUID *Protocol, IN EFI_INTERFACE_TYPE InterfaceType, IN VOID *Interface)
+{
+	return install_protocol_interface(__builtin_return_address(0),Handle,Protocol,InterfaceType,Interface);
+}
+
 EFI_STATUS EFIAPI InstallMultipleProtocolInterfaces(IN OUT EFI_HANDLE *Handle, ...)
 {
 	if (!Handle) return EFI_INVALID_PARAMETER;
@@ -104,41 +157,174 @@ EFI_STATUS EFIAPI InstallMultipleProtocolInterfaces(IN OUT EFI_HANDLE *Handle, .
 		EFI_GUID* Protocol=__ms_va_arg(ap, EFI_GUID*);
 		if (!Protocol) break;
 		VOID* Interface=__ms_va_arg(ap, VOID*);
-		InstallProtocolInterface(Handle,Protocol,EFI_NATIVE_INTERFACE,Interface);
+		install_protocol_interface(__builtin_return_address(0),Handle,Protocol,EFI_NATIVE_INTERFACE,Interface);
 	}
 	__ms_va_end(ap);
 
 	return EFI_SUCCESS;
 }
 
+// Pool and page allocations that are currently live, for the exit report
+static std::atomic<size_t> g_live_bytes(0);
+static std::atomic<size_t> g_live_blocks(0);
+static std::atomic<size_t> g_peak_bytes(0);
+static std::atomic<size_t> g_peak_blocks(0);
+static std::atomic<size_t> g_peak_ranges(0);
+
+static void raise_peak(std::atomic<size_t>& peak,size_t value)
+{
+	size_t old=peak.load(std::memory_order_relaxed);
+	while (value>old && !peak.compare_exchange_weak(old,value,std::memory_order_relaxed));
+}
+
+// size must be the same as the block.size check_free finds when it is freed
+static void account_allocation(size_t size)
+{
+	raise_peak(g_peak_bytes,g_live_bytes.fetch_add(size,std::memory_order_relaxed)+size);
+	raise_peak(g_peak_blocks,g_live_blocks.fetch_add(1,std::memory_order_relaxed)+1);
+	raise_peak(g_peak_ranges,memory_map_size());
+}
+
+static void account_free(size_t size)
+{
+	g_live_bytes.fetch_sub(size,std::memory_order_relaxed);
+	g_live_blocks.fetch_sub(1,std::memory_order_relaxed);
+}
+
+void print_allocation_stats()
+{
+	if (!g_peak_blocks) return;
+	fprintf(stdout,"Allocations: peak %zu bytes in %zu blocks (%zu ranges), at exit %zu bytes in %zu blocks (%zu ranges)\n",
+		g_peak_bytes.load(),g_peak_blocks.load(),g_peak_ranges.load(),g_live_bytes.load(),g_live_blocks.load(),memory_map_size());
+}
+
+// Checks that p is the start of a live allocation of the given kind. Freed
+// memory is labelled as heap again, so freeing it twice shows up as well as
+// pointers that never came from AllocatePool/AllocatePages. In an image arena,
+// anything but the start of a live block looks like heap as well.
+static bool check_free(const char* fn,void* p,memory_kind kind,owner_id caller,memory_block& block,bool& in_arena)
+{
+	in_arena=arena_lookup(p,block);
+	if (!in_arena) block=lookup_memory(p);
+	if (block.start && block.offset==0 && block.kind==kind)
+	{
+		if (caller!=block.owner)
+			fprintf(stdout,"  allocated by %s, freed by %s\n",block.owner ? owner_name(block.owner) : "unknown",caller ? owner_name(caller) : "unknown");
+		block.size=in_arena ? __jemalloc_sallocx(p,0) : lookup_memory_range(p).size;
+		return true;
+	}
+	if (!block.start)
+		fprintf(stdout,"%s: %016lx is not tracked memory\n",fn,(intptr_t)p);
+	else if (block.kind==MEMORY_HEAP || block.kind==MEMORY_GUARD)
+		fprintf(stdout,"%s: %016lx is not allocated (double free?)\n",fn,(intptr_t)p);
+	else if (block.offset)
+		fprintf(stdout,"%s: %016lx points into %s+%08lx\n",fn,(intptr_t)p,memory_label(block),block.offset);
+	else
+		fprintf(stdout,"%s: %016lx is not a %s allocation but %s\n",fn,(intptr_t)p,memory_kind_name(kind),memory_label(block));
+	return false;
+}
+
+// Free memory can't be allocated, and the range between the last standard
+// type and the OEM types is reserved.
+static bool valid_memory_type(EFI_MEMORY_TYPE type)
+{
+	return type!=EfiConventionalMemory && ((UINT32)type<EfiMaxMemoryType || (UINT32)type>=0x70000000);
+}
+
 EFI_STATUS EFIAPI AllocatePool(IN EFI_MEMORY_TYPE PoolType, IN UINTN Size, OUT VOID **Buffer)
 {
 	if (Buffer==NULL) return EFI_INVALID_PARAMETER;
+	if (!valid_memory_type(PoolType)) return EFI_INVALID_PARAMETER;
 	
-	*Buffer=__jemalloc_malloc(Size);
+	owner_id owner=find_pe_caller(__builtin_return_address(0));
+	size_t size=Size; // the usable size for arena blocks
+	*Buffer=guardalloc_alloc(Size,owner);
+	bool in_arena=!*Buffer && (*Buffer=arena_alloc(owner,&size,MEMORY_POOL));
+	if (!*Buffer && (*Buffer=__jemalloc_malloc(Size))) arena_release_chunks(*Buffer);
 	
 	if (!*Buffer) return EFI_OUT_OF_RESOURCES;
 
-	register_memory({*Buffer,Size,string(find_pe_caller_id())+"::MALLOC"});
+	// arena blocks are attributed by their chunk; a zero-sized range would
+	// not be tracked and could not be freed
+	if (!in_arena)
+	{
+		size=std::max<UINTN>(Size,1);
+		register_memory({*Buffer,size,owner,MEMORY_POOL});
+	}
+	memmap_allocate(*Buffer,size,PoolType);
+	account_allocation(size);
 	fprintf(stdout,"AllocatePool\n  @address %016lx, size=%lx\n",(intptr_t)*Buffer,Size);
 
 	return EFI_SUCCESS;
 }
 
+EFI_STATUS EFIAPI FreePool(IN VOID *Buffer)
+{
+	fprintf(stdout,"FreePool\n  @address %016lx\n",(intptr_t)Buffer);
+	owner_id caller=find_pe_caller(__builtin_return_address(0));
+	memory_block block;
+	bool in_arena;
+	if (!check_free("FreePool",Buffer,MEMORY_POOL,caller,block,in_arena)) return EFI_INVALID_PARAMETER;
+	if (in_arena && !arena_free(block)) return EFI_INVALID_PARAMETER; // freed concurrently
+
+	memmap_free(Buffer,block.size);
+	if (!in_arena && !guardalloc_free(Buffer,caller))
+	{
+		__jemalloc_free(Buffer);
+		unregister_memory(Buffer,block.size);
+	}
+	account_free(block.size);
+
+	return EFI_SUCCESS;
+}
+
 EFI_STATUS EFIAPI AllocatePages(IN EFI_ALLOCATE_TYPE Type, IN EFI_MEMORY_TYPE MemoryType, IN UINTN NoPages, OUT EFI_PHYSICAL_ADDRESS *Memory)
 {
 	if (Memory==NULL) return EFI_INVALID_PARAMETER;
+	if (!valid_memory_type(MemoryType)) return EFI_INVALID_PARAMETER;
 	
-	*Memory=(intptr_t)__jemalloc_malloc(NoPages*4096);
+	owner_id owner=find_pe_caller(__builtin_return_address(0));
+	size_t size=NoPages*4096;
+	*Memory=(intptr_t)guardalloc_alloc(size,owner);
+	bool in_arena=!*Memory && (*Memory=(intptr_t)arena_alloc(owner,&size,MEMORY_PAGES));
+	if (!*Memory && (*Memory=(intptr_t)__jemalloc_malloc(size))) arena_release_chunks((void*)*Memory);
 	
 	if (!*Memory) return EFI_OUT_OF_RESOURCES;
 
-	register_memory({(void*)*Memory,NoPages*4096,string(find_pe_caller_id())+"::MALLOC"});
+	if (!in_arena) register_memory({(void*)*Memory,size,owner,MEMORY_PAGES});
+	memmap_allocate((void*)*Memory,size,MemoryType);
+	account_allocation(size);
 	fprintf(stdout,"AllocatePages\n  @address %016lx, size=%lx\n",*Memory,NoPages*4096);
 
 	return EFI_SUCCESS;
 }
 
+EFI_STATUS EFIAPI FreePages(IN EFI_PHYSICAL_ADDRESS Memory, IN UINTN NoPages)
+{
+	fprintf(stdout,"FreePages\n  @address %016lx, size=%lx\n",Memory,NoPages*4096);
+	owner_id caller=find_pe_caller(__builtin_return_address(0));
+	memory_block block;
+	bool in_arena;
+	if (!check_free("FreePages",(void*)Memory,MEMORY_PAGES,caller,block,in_arena)) return EFI_NOT_FOUND;
+	// arena blocks have their usable size, which is larger for huge blocks
+	if (block.size!=(in_arena ? __jemalloc_nallocx(NoPages*4096,0) : NoPages*4096))
+	{
+		fprintf(stdout,"FreePages: %016lx was allocated with size=%lx\n",Memory,block.size);
+		return EFI_INVALID_PARAMETER;
+	}
+	if (in_arena && !arena_free(block)) return EFI_NOT_FOUND; // freed concurrently
+
+	memmap_free((void*)Memory,block.size);
+	if (!in_arena && !guardalloc_free((void*)Memory,caller))
+	{
+		__jemalloc_free((void*)Memory);
+		unregister_memory((void*)Memory,block.size);
+	}
+	account_free(block.size);
+
+	return EFI_SUCCESS;
+}
+
 VOID EFIAPI SetMem(IN VOID *Buffer, IN UINTN Size, IN UINT8 Value)
 {
 	if (Buffer==NULL) return;
@@ -165,11 +351,19 @@ VOID EFIAPI CopyMem(IN VOID *Destination, IN VOID *Source, IN UINTN Length)
 		fprintf(stdout,"IGNORE: CopyMem\n  src=%016lx, dst=%016lx, size=%lx\n",(intptr_t)Source,(intptr_t)Destination,Length);
 }
 
+// Monotonic counts follow virtual time, but are strictly increasing even when
+// queried more often than the clock ticks.
+static std::atomic<UINT64> g_monotonic_count(0);
+
 EFI_STATUS EFIAPI GetNextMonotonicCount(OUT UINT64 *Count)
 {
 	if (Count==NULL) return EFI_INVALID_PARAMETER;
 	
-	*Count=__rdtsc();
+	UINT64 cur=g_monotonic_count.load(),next;
+	do
+		next=std::max(cur+1,vclock_now());
+	while (!g_monotonic_count.compare_exchange_weak(cur,next));
+	*Count=next;
 	
 	return EFI_SUCCESS;
 }
@@ -178,51 +372,45 @@ EFI_STATUS EFIAPI GetNextHighMonotonicCount(OUT UINT32 *HighCount)
 {
 	if (HighCount==NULL) return EFI_INVALID_PARAMETER;
 	
-	*HighCount=__rdtsc()>>32;
+	UINT64 cur=g_monotonic_count.load(),next;
+	do
+		next=std::max(((cur>>32)+1)<<32,vclock_now());
+	while (!g_monotonic_count.compare_exchange_weak(cur,next));
+	*HighCount=next>>32;
 	
 	return EFI_SUCCESS;
 }
 
-EFI_STATUS EFIAPI OutputString(IN SIMPLE_TEXT_OUTPUT_INTERFACE *This, IN CHAR16 *String)
-{
-	char16_print("EFI Output: ",String);
-}
-
-EFI_STATUS EFIAPI GetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, OUT UINT32 *Attributes OPTIONAL, IN OUT UINTN *DataSize, OUT VOID *Data)
+EFI_STATUS EFIAPI GetTime(OUT EFI_TIME *Time, OUT EFI_TIME_CAPABILITIES *Capabilities OPTIONAL)
 {
-	if (VariableName==NULL) return EFI_INVALID_PARAMETER;
-	if (VendorGuid==NULL) return EFI_INVALID_PARAMETER;
-	if (DataSize==NULL) return EFI_INVALID_PARAMETER;
-	if (Data==NULL) return EFI_INVALID_PARAMETER;
-
-	UINTN data_size;
-	UINT32 attributes;
-	void* data=get_variable(VendorGuid,VariableName,&data_size,&attributes);
-
-	fprintf(stdout,"GetVariable Vendor %s, ",guid_string(VendorGuid));
-	char16_print("Variable name:",VariableName);
-
-	if (data!=NULL)
+	if (Time==NULL) return EFI_INVALID_PARAMETER;
+	
+	struct timespec ts;
+	struct tm tm;
+	vclock_walltime(&ts);
+	gmtime_r(&ts.tv_sec,&tm);
+	memset(Time,0,sizeof(*Time));
+	Time->Year=tm.tm_year+1900;
+	Time->Month=tm.tm_mon+1;
+	Time->Day=tm.tm_mday;
+	Time->Hour=tm.tm_hour;
+	Time->Minute=tm.tm_min;
+	Time->Second=tm.tm_sec;
+	Time->Nanosecond=ts.tv_nsec;
+	Time->TimeZone=EFI_UNSPECIFIED_TIMEZONE;
+	if (Capabilities)
 	{
-		if ((attributes&EFI_VARIABLE_RUNTIME_ACCESS)==0) return EFI_NOT_FOUND;
-		if (*DataSize<data_size) return EFI_BUFFER_TOO_SMALL;
-		memcpy(Data,data,data_size);
-		if (Attributes!=NULL) *Attributes=attributes;
+		Capabilities->Resolution=10000000;
+		Capabilities->Accuracy=0;
+		Capabilities->SetsToZero=FALSE;
 	}
-	else
-		return EFI_NOT_FOUND;
+	
+	return EFI_SUCCESS;
 }
 
-EFI_STATUS EFIAPI SetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, IN UINT32 Attributes, IN UINTN DataSize, IN VOID *Data)
+EFI_STATUS EFIAPI OutputString(IN SIMPLE_TEXT_OUTPUT_INTERFACE *This, IN CHAR16 *String)
 {
-	if (VariableName==NULL) return EFI_INVALID_PARAMETER;
-	if (VendorGuid==NULL) return EFI_INVALID_PARAMETER;
-	if (Data==NULL) return EFI_INVALID_PARAMETER;
-
-	fprintf(stdout,"IGNORE: SetVariable Vendor %s, ",guid_string(VendorGuid));
-	char16_print("Variable name:",VariableName);
-
-	return EFI_NOT_FOUND;
+	char16_print("EFI Output: ",String);
 }
 
 EFI_STATUS EFIAPI LocateHandleBuffer(IN EFI_LOCATE_SEARCH_TYPE SearchType, IN EFI_GUID *Protocol OPTIONAL, IN VOID *SearchKey OPTIONAL, IN OUT UINTN *NoHandles, OUT EFI_HANDLE **Buffer)
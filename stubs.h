@@ -27,14 +27,15 @@ EFI_STATUS EFIAPI LocateProtocol(IN EFI_GUID *Protocol,IN VOID *Registration OPT
 EFI_STATUS EFIAPI InstallProtocolInterface(IN OUT EFI_HANDLE *Handle, IN EFI_GUID *Protocol, IN EFI_INTERFACE_TYPE InterfaceType, IN VOID *Interface);
 EFI_STATUS EFIAPI InstallMultipleProtocolInterfaces(IN OUT EFI_HANDLE *Handle, ...);
 EFI_STATUS EFIAPI AllocatePool(IN EFI_MEMORY_TYPE PoolType, IN UINTN Size, OUT VOID **Buffer);
+EFI_STATUS EFIAPI FreePool(IN VOID *Buffer);
 EFI_STATUS EFIAPI AllocatePages(IN EFI_ALLOCATE_TYPE Type, IN EFI_MEMORY_TYPE MemoryType, IN UINTN NoPages, OUT EFI_PHYSICAL_ADDRESS *Memory);
+EFI_STATUS EFIAPI FreePages(IN EFI_PHYSICAL_ADDRESS Memory, IN UINTN NoPages);
 VOID       EFIAPI SetMem(IN VOID *Buffer, IN UINTN Size, IN UINT8 Value);
 VOID       EFIAPI CopyMem(IN VOID *Destination, IN VOID *Source, IN UINTN Length);
 EFI_STATUS EFIAPI GetNextMonotonicCount(OUT UINT64 *Count);
 EFI_STATUS EFIAPI GetNextHighMonotonicCount(OUT UINT32 *HighCount);
+EFI_STATUS EFIAPI GetTime(OUT EFI_TIME *Time, OUT EFI_TIME_CAPABILITIES *Capabilities OPTIONAL);
 EFI_STATUS EFIAPI OutputString(IN SIMPLE_TEXT_OUTPUT_INTERFACE *This, IN CHAR16 *String);
-EFI_STATUS EFIAPI GetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, OUT UINT32 *Attributes OPTIONAL, IN OUT UINTN *DataSize, OUT VOID *Data);
-EFI_STATUS EFIAPI SetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, IN UINT32 Attributes, IN UINTN DataSize, IN VOID *Data);
 EFI_STATUS EFIAPI LocateHandleBuffer(IN EFI_LOCATE_SEARCH_TYPE SearchType, IN EFI_GUID *Protocol OPTIONAL, IN VOID *SearchKey OPTIONAL, IN OUT UINTN *NoHandles, OUT EFI_HANDLE **Buffer);
 EFI_STATUS EFIAPI InSmm(IN VOID *This,OUT BOOLEAN *pInSmm);
 EFI_STATUS EFIAPI GetSmstLocation(IN VOID *This, IN OUT VOID **Smst);
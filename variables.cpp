@@ -0,0 +1,317 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <mutex>
+#include <unordered_set>
+
+#include "main.h"
+#include "variables.h"
+
+// A variable, which is also used as a lookup key. Keys point into the
+// variable itself, or into the caller's arguments for lookups. Name lengths
+// and hashes are computed once, so that probing only compares hashes and
+// lengths before touching the name.
+struct variable
+{
+	EFI_GUID guid;
+	CHAR16* name;
+	size_t name_len; // in characters, without the terminator
+	size_t hash;
+	void* data;
+	UINTN data_size;
+	UINT32 attributes;
+	bool owns_name;  // false for variables imported in place, see
+	bool owns_data;  // import_variable
+	variable* prev;  // enumeration order, for GetNextVariableName
+	variable* next;
+};
+
+struct variable_hash
+{
+	size_t operator()(const variable* v) const { return v->hash; }
+};
+
+struct variable_equal
+{
+	bool operator()(const variable* a,const variable* b) const
+	{
+		return a->hash==b->hash && a->name_len==b->name_len
+			&& !memcmp(&a->guid,&b->guid,sizeof(EFI_GUID))
+			&& !memcmp(a->name,b->name,a->name_len*sizeof(CHAR16));
+	}
+};
+
+static std::unordered_set<variable*,variable_hash,variable_equal> g_variables;
+static variable* g_variables_head=NULL;
+static variable* g_variables_tail=NULL;
+static std::mutex g_variables_lock;
+static bool g_runtime=false;
+
+// Fills in the key part of v: name length and combined hash
+static void make_key(variable& v,EFI_GUID const& guid,const CHAR16* name)
+{
+	UINT64 h=0xcbf29ce484222325ULL; // FNV-1a
+	size_t len=0;
+	for (;name[len];len++)
+	{
+		h^=name[len];
+		h*=0x100000001b3ULL;
+	}
+	v.guid=guid;
+	v.name=(CHAR16*)name;
+	v.name_len=len;
+	v.hash=guid_hash(guid)^(h*0x9e3779b97f4a7c15ULL);
+}
+
+static bool visible(const variable* v)
+{
+	return !g_runtime || (v->attributes&EFI_VARIABLE_RUNTIME_ACCESS);
+}
+
+static variable* find_locked(EFI_GUID const& guid,const CHAR16* name)
+{
+	variable key;
+	make_key(key,guid,name);
+	auto it=g_variables.find(&key);
+	return it==g_variables.end() ? NULL : *it;
+}
+
+static variable* create_locked(EFI_GUID const& guid,const CHAR16* name,bool copy_name=true)
+{
+	variable* v=new variable();
+	make_key(*v,guid,name);
+	if (copy_name)
+	{
+		size_t bytes=(v->name_len+1)*sizeof(CHAR16);
+		v->name=(CHAR16*)malloc(bytes);
+		memcpy(v->name,name,bytes);
+		v->owns_name=true;
+	}
+	g_variables.insert(v);
+	v->prev=g_variables_tail;
+	if (g_variables_tail) g_variables_tail->next=v;
+	else g_variables_head=v;
+	g_variables_tail=v;
+	return v;
+}
+
+static void delete_locked(variable* v)
+{
+	g_variables.erase(v);
+	if (v->prev) v->prev->next=v->next;
+	else g_variables_head=v->next;
+	if (v->next) v->next->prev=v->prev;
+	else g_variables_tail=v->prev;
+	if (v->owns_name) free(v->name);
+	if (v->owns_data) free(v->data);
+	delete v;
+}
+
+static void assign_locked(variable* v,const void* data,UINTN data_size,UINT32 attributes)
+{
+	void* copy=malloc(data_size);
+	memcpy(copy,data,data_size);
+	if (v->owns_data) free(v->data);
+	v->data=copy;
+	v->owns_data=true;
+	v->data_size=data_size;
+	v->attributes=attributes;
+}
+
+static void append_locked(variable* v,const void* data,UINTN data_size)
+{
+	if (!v->owns_data)
+	{
+		void* copy=malloc(v->data_size+data_size);
+		memcpy(copy,v->data,v->data_size);
+		v->data=copy;
+		v->owns_data=true;
+	}
+	else
+	{
+		v->data=realloc(v->data,v->data_size+data_size);
+	}
+	memcpy((char*)v->data+v->data_size,data,data_size);
+	v->data_size+=data_size;
+}
+
+void* get_variable(EFI_GUID* guid,CHAR16* name,UINTN* data_size,UINT32* attributes)
+{
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	variable* v=find_locked(*guid,name);
+	if (!v) return NULL;
+	if (data_size) *data_size=v->data_size;
+	if (attributes) *attributes=v->attributes;
+	return v->data;
+}
+
+void set_variable(EFI_GUID* guid,const CHAR16* name,void* data,UINTN data_size,UINT32 attributes)
+{
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	variable* v=find_locked(*guid,name);
+	if (!v) v=create_locked(*guid,name);
+	assign_locked(v,data,data_size,attributes);
+}
+
+void import_variable(EFI_GUID const& guid,const CHAR16* name,const void* data,UINTN data_size,UINT32 attributes,bool replace)
+{
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	variable* v=find_locked(guid,name);
+	if (v)
+	{
+		if (!replace) return;
+		if (v->owns_data) free(v->data);
+	}
+	else
+	{
+		v=create_locked(guid,name,false);
+	}
+	v->data=(void*)data;
+	v->data_size=data_size;
+	v->attributes=attributes;
+	v->owns_data=false;
+}
+
+bool remove_variable(EFI_GUID const& guid,const CHAR16* name)
+{
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	variable* v=find_locked(guid,name);
+	if (!v) return false;
+	delete_locked(v);
+	return true;
+}
+
+void variables_enter_runtime()
+{
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	g_runtime=true;
+}
+
+EFI_STATUS EFIAPI GetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, OUT UINT32 *Attributes OPTIONAL, IN OUT UINTN *DataSize, OUT VOID *Data)
+{
+	if (VariableName==NULL) return EFI_INVALID_PARAMETER;
+	if (VendorGuid==NULL) return EFI_INVALID_PARAMETER;
+	if (DataSize==NULL) return EFI_INVALID_PARAMETER;
+
+	fprintf(stdout,"GetVariable Vendor %s, ",guid_string(VendorGuid));
+	char16_print("Variable name:",VariableName);
+
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	variable* v=find_locked(*VendorGuid,VariableName);
+	if (!v || !visible(v)) return EFI_NOT_FOUND;
+	if (Attributes!=NULL) *Attributes=v->attributes;
+	// a size query may pass NULL for Data
+	if (*DataSize<v->data_size)
+	{
+		*DataSize=v->data_size;
+		return EFI_BUFFER_TOO_SMALL;
+	}
+	if (Data==NULL) return EFI_INVALID_PARAMETER;
+	memcpy(Data,v->data,v->data_size);
+	*DataSize=v->data_size;
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS EFIAPI GetNextVariableName(IN OUT UINTN *VariableNameSize, IN OUT CHAR16 *VariableName, IN OUT EFI_GUID *VendorGuid)
+{
+	if (VariableNameSize==NULL) return EFI_INVALID_PARAMETER;
+	if (VariableName==NULL) return EFI_INVALID_PARAMETER;
+	if (VendorGuid==NULL) return EFI_INVALID_PARAMETER;
+
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	variable* v;
+	if (VariableName[0]==0)
+	{
+		v=g_variables_head;
+	}
+	else
+	{
+		v=find_locked(*VendorGuid,VariableName);
+		if (!v || !visible(v)) return EFI_INVALID_PARAMETER;
+		v=v->next;
+	}
+	while (v && !visible(v)) v=v->next;
+	if (!v) return EFI_NOT_FOUND;
+
+	UINTN bytes=(v->name_len+1)*sizeof(CHAR16);
+	if (*VariableNameSize<bytes)
+	{
+		*VariableNameSize=bytes;
+		return EFI_BUFFER_TOO_SMALL;
+	}
+	memcpy(VariableName,v->name,bytes);
+	*VariableNameSize=bytes;
+	*VendorGuid=v->guid;
+
+	return EFI_SUCCESS;
+}
+
+EFI_STATUS EFIAPI SetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, IN UINT32 Attributes, IN UINTN DataSize, IN VOID *Data)
+{
+	if (VariableName==NULL || VariableName[0]==0) return EFI_INVALID_PARAMETER;
+	if (VendorGuid==NULL) return EFI_INVALID_PARAMETER;
+	if (DataSize!=0 && Data==NULL) return EFI_INVALID_PARAMETER;
+
+	fprintf(stdout,"SetVariable Vendor %s, attributes=%08x size=%lu, ",guid_string(VendorGuid),Attributes,DataSize);
+	char16_print("Variable name:",VariableName);
+
+	// Authenticated writes carry a signed descriptor that we cannot verify
+	if (Attributes&(EFI_VARIABLE_AUTHENTICATED_WRITE_ACCESS|EFI_VARIABLE_TIME_BASED_AUTHENTICATED_WRITE_ACCESS))
+		return EFI_UNSUPPORTED;
+	if ((Attributes&EFI_VARIABLE_RUNTIME_ACCESS) && !(Attributes&EFI_VARIABLE_BOOTSERVICE_ACCESS))
+		return EFI_INVALID_PARAMETER;
+
+	bool append=Attributes&EFI_VARIABLE_APPEND_WRITE;
+	UINT32 attributes=Attributes&~EFI_VARIABLE_APPEND_WRITE;
+	bool remove=attributes==0 || (DataSize==0 && !append);
+
+	std::lock_guard<std::mutex> lock(g_variables_lock);
+	// at runtime only non-volatile runtime variables can be written
+	if (g_runtime && !remove && (attributes&(EFI_VARIABLE_RUNTIME_ACCESS|EFI_VARIABLE_NON_VOLATILE))!=(EFI_VARIABLE_RUNTIME_ACCESS|EFI_VARIABLE_NON_VOLATILE))
+		return EFI_INVALID_PARAMETER;
+
+	variable* v=find_locked(*VendorGuid,VariableName);
+	if (v && !visible(v)) return remove ? EFI_NOT_FOUND : EFI_WRITE_PROTECTED;
+	if (remove)
+	{
+		if (!v) return EFI_NOT_FOUND;
+		if (v->attributes&EFI_VARIABLE_NON_VOLATILE) log_variable_write(v->guid,v->name,v->name_len,0,NULL,0);
+		delete_locked(v);
+		return EFI_SUCCESS;
+	}
+	if (v && v->attributes!=attributes) return EFI_INVALID_PARAMETER;
+	if (!v)
+	{
+		v=create_locked(*VendorGuid,VariableName);
+		v->attributes=attributes;
+	}
+	if (append)
+		append_locked(v,Data,DataSize);
+	else
+		assign_locked(v,Data,DataSize,attributes);
+	// appends are logged with their result, so replay only has to set
+	if (attributes&EFI_VARIABLE_NON_VOLATILE) log_variable_write(v->guid,v->name,v->name_len,attributes,v->data,v->data_size);
+
+	return EFI_SUCCESS;
+}
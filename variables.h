@@ -0,0 +1,61 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef VARIABLES_H
+#define VARIABLES_H
+
+#include <efi.h>
+
+#ifndef EFI_VARIABLE_TIME_BASED_AUTHENTICATED_WRITE_ACCESS
+#define EFI_VARIABLE_TIME_BASED_AUTHENTICATED_WRITE_ACCESS 0x00000020
+#endif
+#ifndef EFI_VARIABLE_APPEND_WRITE
+#define EFI_VARIABLE_APPEND_WRITE 0x00000040
+#endif
+
+EFI_STATUS EFIAPI GetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, OUT UINT32 *Attributes OPTIONAL, IN OUT UINTN *DataSize, OUT VOID *Data);
+EFI_STATUS EFIAPI GetNextVariableName(IN OUT UINTN *VariableNameSize, IN OUT CHAR16 *VariableName, IN OUT EFI_GUID *VendorGuid);
+EFI_STATUS EFIAPI SetVariable(IN CHAR16 *VariableName, IN EFI_GUID *VendorGuid, IN UINT32 Attributes, IN UINTN DataSize, IN VOID *Data);
+
+// Adds a variable without copying its name or data, which must stay valid
+// and unchanged for the rest of the run. The name must be NUL-terminated. The
+// data is copied when the variable is first modified. An existing variable
+// is only replaced if replace is set.
+void import_variable(EFI_GUID const& guid,const CHAR16* name,const void* data,UINTN data_size,UINT32 attributes,bool replace);
+
+// Imports all variable stores found in a ROM image or NVRAM dump, which is
+// mapped for the rest of the run. Implemented in nvram.cpp.
+bool import_nvram(const char* filename);
+
+// Removes a variable without logging it.
+// @returns Whether the variable existed.
+bool remove_variable(EFI_GUID const& guid,const CHAR16* name);
+
+// Persistent log of non-volatile variable writes, implemented in varlog.cpp.
+// Opening it applies the logged state on top of the current variables.
+bool open_variable_log(const char* filename);
+void close_variable_log();
+// Appends a record; attributes is 0 for a deletion. Called by SetVariable.
+void log_variable_write(EFI_GUID const& guid,const CHAR16* name,size_t name_len,UINT32 attributes,const void* data,UINTN data_size);
+
+// From here on only runtime-accessible variables are visible, as after
+// ExitBootServices.
+void variables_enter_runtime();
+
+#endif //VARIABLES_H
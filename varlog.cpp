@@ -0,0 +1,325 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+#include "main.h"
+#include "variables.h"
+
+// Append-only log of non-volatile variable writes, all integers
+// little-endian:
+//   char magic[8]   "EPRVLOG1"
+//   records, each padded to 8 bytes:
+//     uint32_t magic       'VREC'
+//     uint32_t size        whole record including padding
+//     uint32_t attributes  0 for a deletion
+//     uint32_t name_size   in bytes, including the terminator
+//     uint32_t data_size
+//     uint32_t checksum    FNV-1a over guid, name and data
+//     EFI_GUID guid
+//     CHAR16   name[name_size/2]
+//     uint8_t  data[data_size]
+// Only the latest record per variable is live. A torn record at the end, e.g.
+// after a crash, is cut off when the log is opened.
+static const char g_varlog_magic[8]={'E','P','R','V','L','O','G','1'};
+
+#define RECORD_MAGIC 0x43455256 // 'VREC'
+#define COMPACT_MIN_GARBAGE (64*1024)
+
+struct record_header
+{
+	UINT32 magic;
+	UINT32 size;
+	UINT32 attributes;
+	UINT32 name_size;
+	UINT32 data_size;
+	UINT32 checksum;
+	EFI_GUID guid;
+};
+
+struct live_record
+{
+	UINT64 offset;
+	UINT32 size;
+};
+
+// g_log_lock protects everything below. Writers hold g_variables_lock in
+// variables.cpp as well, so records are appended in the order they were
+// applied.
+static std::mutex g_log_lock;
+static string g_log_path;
+static int g_log_fd=-1;
+static UINT64 g_log_size;
+static UINT64 g_live_size;
+static unordered_map<string,live_record> g_live; // GUID bytes + name bytes
+static bool g_compacting=false;
+static std::thread g_compactor;
+
+static string record_key(EFI_GUID const& guid,const CHAR16* name,size_t name_size)
+{
+	string key((const char*)&guid,sizeof(EFI_GUID));
+	key.append((const char*)name,name_size);
+	return key;
+}
+
+static UINT32 checksum(const record_header* r)
+{
+	UINT32 h=2166136261U;
+	const unsigned char* p=(const unsigned char*)&r->guid;
+	size_t len=sizeof(EFI_GUID)+r->name_size+r->data_size;
+	for (size_t i=0;i<len;i++)
+	{
+		h^=p[i];
+		h*=16777619U;
+	}
+	return h;
+}
+
+static UINT64 record_size(UINT64 name_size,UINT64 data_size)
+{
+	return (sizeof(record_header)+name_size+data_size+7)&~(UINT64)7;
+}
+
+// Validates the record at offset in a log of the given size.
+static const record_header* record_at(const char* base,UINT64 offset,UINT64 size)
+{
+	if (size-offset<sizeof(record_header)) return NULL;
+	const record_header* r=(const record_header*)(base+offset);
+	if (r->magic!=RECORD_MAGIC || r->size>size-offset) return NULL;
+	// in 64 bits, so that huge name or data sizes can't wrap around
+	if (sizeof(record_header)+(UINT64)r->name_size+r->data_size>r->size) return NULL;
+	if (r->name_size<sizeof(CHAR16) || r->name_size%sizeof(CHAR16)) return NULL;
+	if (r->size!=record_size(r->name_size,r->data_size)) return NULL;
+	const CHAR16* name=(const CHAR16*)(r+1);
+	if (name[r->name_size/sizeof(CHAR16)-1]!=0) return NULL;
+	if (r->checksum!=checksum(r)) return NULL;
+	return r;
+}
+
+static string record_key(const record_header* r)
+{
+	return record_key(r->guid,(const CHAR16*)(r+1),r->name_size);
+}
+
+static void track_locked(const record_header* r,UINT64 offset)
+{
+	auto& live=g_live[record_key(r)];
+	g_live_size+=r->size;
+	g_live_size-=live.size;
+	live.offset=offset;
+	live.size=r->size;
+}
+
+bool open_variable_log(const char* filename)
+{
+	int fd=open(filename,O_RDWR|O_CREAT,0644);
+	if (fd==-1)
+	{
+		fprintf(stderr,"Unable to open variable log %s\n",filename);
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd,&st))
+	{
+		perror(filename);
+		close(fd);
+		return false;
+	}
+	UINT64 size=st.st_size;
+	if (size==0)
+	{
+		if (write(fd,g_varlog_magic,sizeof(g_varlog_magic))!=sizeof(g_varlog_magic))
+		{
+			close(fd);
+			return false;
+		}
+		size=sizeof(g_varlog_magic);
+	}
+
+	// Records are imported in place, so the mapping stays for the rest of
+	// the run, even after compaction has replaced the file.
+	const char* base=(const char*)mmap(NULL,size,PROT_READ,MAP_PRIVATE,fd,0);
+	if (base==MAP_FAILED || memcmp(base,g_varlog_magic,sizeof(g_varlog_magic)))
+	{
+		fprintf(stderr,"%s is not a variable log\n",filename);
+		close(fd);
+		return false;
+	}
+
+	std::unique_lock<std::mutex> lock(g_log_lock);
+	UINT64 offset=sizeof(g_varlog_magic);
+	while (const record_header* r=record_at(base,offset,size))
+	{
+		track_locked(r,offset);
+		offset+=r->size;
+	}
+	if (offset!=size)
+	{
+		fprintf(stdout,"Variable log %s: discarding %lu bytes of torn records\n",filename,size-offset);
+		if (ftruncate(fd,offset)) perror("ftruncate");
+	}
+
+	// only the latest record per variable is applied
+	vector<const record_header*> live;
+	for (UINT64 o=sizeof(g_varlog_magic);o<offset;o+=((const record_header*)(base+o))->size)
+	{
+		const record_header* r=(const record_header*)(base+o);
+		if (g_live[record_key(r)].offset==o) live.push_back(r);
+	}
+	UINT64 live_size=g_live_size;
+	lock.unlock();
+
+	// without g_log_lock, since variables.cpp takes g_variables_lock first
+	for (auto r : live)
+	{
+		const CHAR16* name=(const CHAR16*)(r+1);
+		if (r->attributes)
+			import_variable(r->guid,name,(const char*)name+r->name_size,r->data_size,r->attributes,true);
+		else
+			remove_variable(r->guid,name);
+	}
+	fprintf(stdout,"Variable log %s: %zu live records, %lu of %lu bytes live\n",filename,live.size(),live_size,offset);
+
+	lock.lock();
+	lseek(fd,offset,SEEK_SET);
+	g_log_path=filename;
+	g_log_fd=fd;
+	g_log_size=offset;
+	return true;
+}
+
+// Writes the live records into a new file and replaces the log with it.
+// Records appended in the meantime are carried over at the end.
+static void compact()
+{
+	std::unique_lock<std::mutex> lock(g_log_lock);
+	int old_fd=g_log_fd;
+	UINT64 snapshot_size=g_log_size;
+	vector<live_record> live;
+	live.reserve(g_live.size());
+	for (auto& l : g_live) live.push_back(l.second);
+	lock.unlock();
+
+	string tmp_path=g_log_path+".tmp";
+	int fd=open(tmp_path.c_str(),O_RDWR|O_CREAT|O_TRUNC,0644);
+	if (fd==-1)
+	{
+		perror("compact: open");
+		lock.lock();
+		g_compacting=false;
+		return;
+	}
+	// keep the original order, so enumeration order survives a restart
+	std::sort(live.begin(),live.end(),[](const live_record& a,const live_record& b) { return a.offset<b.offset; });
+	unordered_map<UINT64,UINT64> moved; // old offset -> new offset
+	string buf(g_varlog_magic,sizeof(g_varlog_magic));
+	for (auto& l : live)
+	{
+		moved[l.offset]=buf.size();
+		size_t at=buf.size();
+		buf.resize(at+l.size);
+		if (pread(old_fd,&buf[at],l.size,l.offset)!=(ssize_t)l.size) perror("compact: pread");
+	}
+
+	lock.lock();
+	// carry over what was appended since the snapshot
+	UINT64 tail=g_log_size-snapshot_size;
+	UINT64 tail_start=buf.size();
+	buf.resize(tail_start+tail);
+	if (tail && pread(old_fd,&buf[tail_start],tail,snapshot_size)!=(ssize_t)tail) perror("compact: pread");
+	if (write(fd,buf.data(),buf.size())!=(ssize_t)buf.size() || fsync(fd) || rename(tmp_path.c_str(),g_log_path.c_str()))
+	{
+		perror("compact");
+		close(fd);
+		unlink(tmp_path.c_str());
+		g_compacting=false;
+		return;
+	}
+	for (auto& l : g_live)
+	{
+		if (l.second.offset>=snapshot_size)
+			l.second.offset=l.second.offset-snapshot_size+tail_start;
+		else
+			l.second.offset=moved[l.second.offset];
+	}
+	fprintf(stdout,"Variable log compacted from %lu to %lu bytes\n",g_log_size,(UINT64)buf.size());
+	g_log_fd=fd;
+	g_log_size=buf.size();
+	close(old_fd);
+	g_compacting=false;
+}
+
+void log_variable_write(EFI_GUID const& guid,const CHAR16* name,size_t name_len,UINT32 attributes,const void* data,UINTN data_size)
+{
+	std::lock_guard<std::mutex> lock(g_log_lock);
+	if (g_log_fd==-1) return;
+
+	UINT32 name_size=(name_len+1)*sizeof(CHAR16);
+	if (!attributes) data_size=0;
+	string buf(record_size(name_size,data_size),'\0');
+	record_header* r=(record_header*)&buf[0];
+	r->magic=RECORD_MAGIC;
+	r->size=buf.size();
+	r->attributes=attributes;
+	r->name_size=name_size;
+	r->data_size=data_size;
+	r->guid=guid;
+	memcpy(r+1,name,name_size);
+	if (data_size) memcpy((char*)(r+1)+name_size,data,data_size);
+	r->checksum=checksum(r);
+
+	if (write(g_log_fd,buf.data(),buf.size())!=(ssize_t)buf.size())
+	{
+		perror("log_variable_write");
+		return;
+	}
+	track_locked(r,g_log_size);
+	g_log_size+=buf.size();
+
+	UINT64 garbage=g_log_size-sizeof(g_varlog_magic)-g_live_size;
+	if (!g_compacting && garbage>=COMPACT_MIN_GARBAGE && garbage>g_live_size)
+	{
+		g_compacting=true;
+		if (g_compactor.joinable()) g_compactor.join();
+		g_compactor=std::thread(compact);
+	}
+}
+
+void close_variable_log()
+{
+	if (g_compactor.joinable()) g_compactor.join();
+	std::lock_guard<std::mutex> lock(g_log_lock);
+	if (g_log_fd!=-1) close(g_log_fd);
+	g_log_fd=-1;
+}
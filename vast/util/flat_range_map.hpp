@@ -0,0 +1,345 @@
+// A drop-in alternative to vast::util::range_map
+#ifndef VAST_UTIL_FLAT_RANGE_MAP_H
+#define VAST_UTIL_FLAT_RANGE_MAP_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vast {
+namespace util {
+
+/// An associative data structure that maps half-open, *disjoint* intervals to
+/// values, with the same interface as range_map.
+///
+/// Intervals are kept in three sorted arrays (left endpoints, right endpoints
+/// and values). Point queries do a branchless binary search over the left
+/// endpoints only, which touches a handful of cache lines instead of chasing
+/// tree nodes. Updates shift the tail of the arrays, which is a memmove for
+/// the endpoints and cheap for moderately sized maps.
+///
+/// The arrays can be exposed to concurrent readers (see lefts()); an
+/// Allocator that defers deallocation keeps them valid for readers that still
+/// look at an old copy.
+template <typename Point, typename Value,
+          template <typename> class Allocator = std::allocator>
+class flat_range_map
+{
+  static_assert(std::is_arithmetic<Point>::value,
+                "Point must be an arithmetic type");
+
+public:
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::tuple<Point, Point, Value>;
+    using reference = std::tuple<Point const&, Point const&, Value const&>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+
+    const_iterator(flat_range_map const* m, size_t i) : map_(m), i_(i) { }
+
+    reference operator*() const
+    {
+      return std::tie(map_->lefts_[i_], map_->rights_[i_], map_->values_[i_]);
+    }
+
+    const_iterator& operator++() { ++i_; return *this; }
+    const_iterator& operator--() { --i_; return *this; }
+    const_iterator operator++(int) { auto t = *this; ++i_; return t; }
+    const_iterator operator--(int) { auto t = *this; --i_; return t; }
+    bool operator==(const_iterator const& o) const { return i_ == o.i_; }
+    bool operator!=(const_iterator const& o) const { return i_ != o.i_; }
+
+  private:
+    flat_range_map const* map_;
+    size_t i_;
+  };
+
+  const_iterator begin() const
+  {
+    return const_iterator{this, 0};
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator{this, lefts_.size()};
+  }
+
+  /// Associates a value with a right-open range.
+  /// @param l The left endpoint of the interval.
+  /// @param r The right endpoint of the interval.
+  /// @param v The value r associated with *[l, r]*.
+  /// @returns `true` on success.
+  bool insert(Point l, Point r, Value v)
+  {
+    if (r<=l) return false;
+    size_t next = upper(l);
+    if (!fits(l, r, next))
+      return false;
+    emplace(next, l, r, std::move(v));
+    return true;
+  }
+
+  /// Inserts a value for a right-open range, updating existing adjacent
+  /// intervals if it's possible to merge them. Two intervals can only be
+  /// merged if they have the same values.
+  /// @note If *[l,r]* reaches into an existing interval, injection fails.
+  /// @param l The left endpoint of the interval.
+  /// @param r The right endpoint of the interval.
+  /// @param v The value r associated with *[l,r]*.
+  /// @returns `true` on success.
+  bool inject(Point l, Point r, Value v)
+  {
+    if (r<=l) return false;
+    size_t next = upper(l);
+    if (!fits(l, r, next))
+      return false;
+    auto left_merge = next > 0 && rights_[next - 1] == l
+                      && values_[next - 1] == v;
+    auto right_merge = next < lefts_.size() && lefts_[next] == r
+                       && values_[next] == v;
+    if (left_merge && right_merge)
+    {
+      rights_[next - 1] = rights_[next];
+      remove(next, next + 1);
+    }
+    else if (left_merge)
+    {
+      rights_[next - 1] = r;
+    }
+    else if (right_merge)
+    {
+      lefts_[next] = l;
+    }
+    else
+    {
+      emplace(next, l, r, std::move(v));
+    }
+    return true;
+  }
+
+  /// Removes a value given a point from a right-open range.
+  /// @param p A point from a range that maps to a value.
+  /// @returns `true` if the value associated with the interval containing *p*
+  ///          has been successfully removed, and `false` if *p* does not map
+  ///          to an existing value.
+  bool erase(Point p)
+  {
+    size_t i = locate(p);
+    if (i == npos)
+      return false;
+    remove(i, i + 1);
+    return true;
+  }
+
+  /// Adjusts or erases ranges so that no values in the map overlap with [l,r)
+  /// @param l The left endpoint of the interval.
+  /// @param r The right endpoint of the interval.
+  void erase(Point l, Point r)
+  {
+    if (r<=l) return;
+    size_t i = upper(l);
+    if (i > 0 && rights_[i - 1] > l)
+    {
+      // the interval before reaches into [l,r)
+      size_t j = i - 1;
+      if (lefts_[j] < l)
+      {
+        if (rights_[j] > r)
+        { // [j) overlaps [l,r) in its entirety
+          Point orig_r = rights_[j];
+          rights_[j] = l;
+          inject(r, orig_r, values_[j]);
+          return;
+        }
+        rights_[j] = l;
+      }
+      else
+      {
+        i = j;
+      }
+    }
+    // everything from i up to k lies within [l,r)
+    size_t k = i;
+    while (k < lefts_.size() && rights_[k] <= r)
+      ++k;
+    remove(i, k);
+    if (i < lefts_.size() && lefts_[i] < r)
+      lefts_[i] = r;
+  }
+
+  /// Retrieves the value for a given point.
+  /// @param p The point to lookup.
+  /// @returns A pointer to the value associated with the half-open interval
+  ///          *[a,b)* if *a <= p < b* and `nullptr` otherwise.
+  Value const* lookup(Point const& p) const
+  {
+    size_t i = locate(p);
+    return i != npos ? &values_[i] : nullptr;
+  }
+
+  /// Retrieves value and interval for a given point.
+  /// @param p The point to lookup.
+  /// @returns A tuple with the last component holding a pointer to the value
+  ///          associated with the half-open interval *[a,b)* if *a <= p < b*,
+  ///          and `nullptr` otherwise. If the last component points to a
+  ///          valid value, then the first two represent *[a,b)* and *[0,0)*
+  ///          otherwise.
+  std::tuple<Point, Point, Value const*> find(Point const& p) const
+  {
+    size_t i = locate(p);
+    if (i == npos)
+      return std::tuple<Point, Point, Value const*>{0, 0, nullptr};
+    else
+      return std::tuple<Point, Point, Value const*>{lefts_[i], rights_[i], &values_[i]};
+  }
+
+  /// Determines the stretch of contiguous intervals that starts with the one
+  /// containing *l*, following neighbours only until *r* is reached.
+  /// @param l The left endpoint of the interval.
+  /// @param r The right endpoint of the interval.
+  /// @returns *[a,b)* with *a <= l < b* such that *[a,min(b,r))* is covered
+  ///          without gaps and *b < r* iff there is a gap in *[l,r)*, or
+  ///          *[l,l)* if *l* is not covered at all.
+  std::pair<Point, Point> coverage(Point l, Point r) const
+  {
+    size_t i = locate(l);
+    if (i == npos)
+      return {l, l};
+    Point a = lefts_[i];
+    size_t n = lefts_.size();
+    while (rights_[i] < r && i + 1 < n && lefts_[i + 1] == rights_[i])
+      ++i;
+    return {a, rights_[i]};
+  }
+
+  /// Checks whether *[l,r)* is covered by intervals without any gaps.
+  /// @param l The left endpoint of the interval.
+  /// @param r The right endpoint of the interval.
+  /// @returns `true` iff every point of *[l,r)* maps to a value, or *r <= l*
+  ///          and *l* maps to a value.
+  bool covers(Point l, Point r) const
+  {
+    auto c = coverage(l, r);
+    return c.second > l && c.second >= r;
+  }
+
+  /// Raw access to the sorted endpoint and value arrays, which hold size()
+  /// elements. Any modification may invalidate them.
+  Point const* lefts() const
+  {
+    return lefts_.data();
+  }
+
+  Point const* rights() const
+  {
+    return rights_.data();
+  }
+
+  Value const* values() const
+  {
+    return values_.data();
+  }
+
+  /// Finds the interval of a point in raw arrays as returned by lefts() and
+  /// rights().
+  /// @returns The index of the interval containing *p*, or `npos`.
+  static size_t locate(Point const* lefts, Point const* rights, size_t n,
+                       Point const& p)
+  {
+    size_t i = upper(lefts, n, p);
+    return i > 0 && p < rights[i - 1] ? i - 1 : npos;
+  }
+
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  /// Retrieves the size of the range map.
+  /// @returns The number of entries in the map.
+  size_t size() const
+  {
+    return lefts_.size();
+  }
+
+  /// Checks whether the range map is empty.
+  /// @returns `true` iff the map is empty.
+  bool empty() const
+  {
+    return lefts_.empty();
+  }
+
+  /// Clears the range map.
+  void clear()
+  {
+    lefts_.clear();
+    rights_.clear();
+    values_.clear();
+  }
+
+private:
+  // Finds the number of intervals with a left endpoint <= p, i.e. the index
+  // of the first interval starting after p. The loop body compiles to a
+  // conditional move.
+  static size_t upper(Point const* lefts, size_t n, Point const& p)
+  {
+    if (n == 0)
+      return 0;
+    Point const* base = lefts;
+    while (n > 1)
+    {
+      size_t half = n / 2;
+      base = base[half] <= p ? base + half : base;
+      n -= half;
+    }
+    return (base - lefts) + (*base <= p);
+  }
+
+  size_t upper(Point const& p) const
+  {
+    return upper(lefts_.data(), lefts_.size(), p);
+  }
+
+  // Finds the interval of a point.
+  size_t locate(Point const& p) const
+  {
+    return locate(lefts_.data(), rights_.data(), lefts_.size(), p);
+  }
+
+  // Checks whether [l,r) fits in front of the interval at index next.
+  bool fits(Point l, Point r, size_t next) const
+  {
+    return (next == 0 || rights_[next - 1] <= l)
+           && (next == lefts_.size() || r <= lefts_[next]);
+  }
+
+  void emplace(size_t i, Point l, Point r, Value v)
+  {
+    lefts_.insert(lefts_.begin() + i, l);
+    rights_.insert(rights_.begin() + i, r);
+    values_.insert(values_.begin() + i, std::move(v));
+  }
+
+  void remove(size_t i, size_t k)
+  {
+    lefts_.erase(lefts_.begin() + i, lefts_.begin() + k);
+    rights_.erase(rights_.begin() + i, rights_.begin() + k);
+    values_.erase(values_.begin() + i, values_.begin() + k);
+  }
+
+  std::vector<Point, Allocator<Point>> lefts_;
+  std::vector<Point, Allocator<Point>> rights_;
+  std::vector<Value, Allocator<Value>> values_;
+};
+
+template <typename Point, typename Value, template <typename> class Allocator>
+constexpr size_t flat_range_map<Point, Value, Allocator>::npos;
+
+} // namespace util
+} // namespace vast
+
+#endif
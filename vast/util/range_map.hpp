@@ -194,8 +194,13 @@ public:
       else if (left(it)<=l && right(it)>=r)
       { // [it) overlaps [l,r) in its entirety
         Point orig_r=right(it);
-        right(it)=l;
-        inject(r,orig_r,value(it));
+        Value v=value(it);
+        // don't leave an empty [l,l) behind, it would block inserts at l
+        if (left(it)==l)
+          map_.erase(it);
+        else
+          right(it)=l;
+        inject(r,orig_r,std::move(v));
         break;
       }
       else if (l<=left(it) && r>left(it))
@@ -0,0 +1,196 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <elf.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/auxv.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+
+#include <atomic>
+
+#include "main.h"
+#include "vclock.h"
+
+static bool g_raw_clock=false; // set while rdtsc is trapped, see below
+
+static UINT64 host_time(clockid_t clock)
+{
+	struct timespec ts;
+	if (g_raw_clock)
+		syscall(SYS_clock_gettime,clock,&ts);
+	else
+		clock_gettime(clock,&ts);
+	return ts.tv_sec*10000000ULL+ts.tv_nsec/100;
+}
+
+static const UINT64 g_start=host_time(CLOCK_MONOTONIC);
+static const UINT64 g_wall_start=host_time(CLOCK_REALTIME);
+static std::atomic<UINT64> g_skipped(0); // total time skipped by fast-forwarding
+static std::atomic<bool> g_fast_forward(false);
+
+UINT64 vclock_now()
+{
+	return host_time(CLOCK_MONOTONIC)-g_start+g_skipped.load(std::memory_order_acquire);
+}
+
+void vclock_skip_to(UINT64 deadline)
+{
+	UINT64 skipped=g_skipped.load();
+	for (;;)
+	{
+		UINT64 now=host_time(CLOCK_MONOTONIC)-g_start+skipped;
+		if (now>=deadline) return;
+		if (g_skipped.compare_exchange_weak(skipped,skipped+(deadline-now))) return;
+	}
+}
+
+void vclock_sleep_until(UINT64 deadline)
+{
+	if (g_fast_forward)
+	{
+		vclock_skip_to(deadline);
+		return;
+	}
+	for (UINT64 now;(now=vclock_now())<deadline;)
+	{
+		UINT64 wait=deadline-now;
+		struct timespec ts={(time_t)(wait/10000000),(long)(wait%10000000)*100};
+		nanosleep(&ts,NULL);
+	}
+}
+
+void vclock_set_fast_forward(bool enable)
+{
+	g_fast_forward=enable;
+}
+
+bool vclock_fast_forward()
+{
+	return g_fast_forward;
+}
+
+void vclock_walltime(struct timespec* ts)
+{
+	UINT64 t=g_wall_start+vclock_now();
+	ts->tv_sec=t/10000000;
+	ts->tv_nsec=(t%10000000)*100;
+}
+
+/* rdtsc trapping
+ *
+ * With PR_TSC_SIGSEGV, rdtsc and rdtscp raise a general protection fault in
+ * user mode. Guest instructions are emulated in the SIGSEGV handler. The
+ * vDSO's clock_gettime uses rdtsc as well and needs the real counter, so
+ * faults inside the vDSO are handled by briefly enabling the TSC and
+ * single-stepping over the instruction. Our own clock reads bypass the vDSO
+ * to keep the handler cheap.
+ */
+
+static struct sigaction g_prev_sigsegv;
+static struct sigaction g_prev_sigtrap;
+static uintptr_t g_vdso_start,g_vdso_end;
+static thread_local bool t_tsc_stepping=false;
+
+#define EFLAGS_TF 0x100
+
+static void find_vdso()
+{
+	uintptr_t base=getauxval(AT_SYSINFO_EHDR);
+	if (!base) return;
+	Elf64_Ehdr* ehdr=(Elf64_Ehdr*)base;
+	Elf64_Phdr* phdr=(Elf64_Phdr*)(base+ehdr->e_phoff);
+	uintptr_t lo=~(uintptr_t)0,hi=0;
+	for (int i=0;i<ehdr->e_phnum;i++)
+	{
+		if (phdr[i].p_type!=PT_LOAD) continue;
+		if (phdr[i].p_vaddr<lo) lo=phdr[i].p_vaddr;
+		if (phdr[i].p_vaddr+phdr[i].p_memsz>hi) hi=phdr[i].p_vaddr+phdr[i].p_memsz;
+	}
+	if (hi<=lo) return;
+	// segment addresses are relative to the start of the mapping
+	g_vdso_start=base;
+	g_vdso_end=base+(hi-lo);
+}
+
+static void rdtsc_sigsegv(int sig,siginfo_t* info,void* ctx)
+{
+	// only general protection faults, for which the instruction can be read
+	if (info->si_code!=SI_KERNEL) return chain_signal(g_prev_sigsegv,sig,info,ctx);
+
+	greg_t* regs=((ucontext_t*)ctx)->uc_mcontext.gregs;
+	const unsigned char* ip=(const unsigned char*)regs[REG_RIP];
+	int len=0;
+	if (ip[0]==0x0f && ip[1]==0x31) len=2;
+	else if (ip[0]==0x0f && ip[1]==0x01 && ip[2]==0xf9) len=3;
+	if (!len) return chain_signal(g_prev_sigsegv,sig,info,ctx);
+
+	if ((uintptr_t)ip>=g_vdso_start && (uintptr_t)ip<g_vdso_end)
+	{
+		prctl(PR_SET_TSC,PR_TSC_ENABLE,0,0,0);
+		regs[REG_EFL]|=EFLAGS_TF;
+		t_tsc_stepping=true;
+		return;
+	}
+
+	UINT64 tsc=vclock_now()*100;
+	regs[REG_RAX]=(UINT32)tsc;
+	regs[REG_RDX]=tsc>>32;
+	if (len==3) regs[REG_RCX]=0; // IA32_TSC_AUX
+	regs[REG_RIP]+=len;
+}
+
+static void rdtsc_sigtrap(int sig,siginfo_t* info,void* ctx)
+{
+	if (!t_tsc_stepping) return chain_signal(g_prev_sigtrap,sig,info,ctx);
+
+	t_tsc_stepping=false;
+	prctl(PR_SET_TSC,PR_TSC_SIGSEGV,0,0,0);
+	((ucontext_t*)ctx)->uc_mcontext.gregs[REG_EFL]&=~EFLAGS_TF;
+}
+
+bool vclock_trap_rdtsc()
+{
+	find_vdso();
+	g_raw_clock=true;
+
+	struct sigaction sa;
+	memset(&sa,0,sizeof(sa));
+	sa.sa_flags=SA_SIGINFO;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_sigaction=rdtsc_sigsegv;
+	sigaction(SIGSEGV,&sa,&g_prev_sigsegv);
+	sa.sa_sigaction=rdtsc_sigtrap;
+	sigaction(SIGTRAP,&sa,&g_prev_sigtrap);
+
+	if (prctl(PR_SET_TSC,PR_TSC_SIGSEGV,0,0,0))
+	{
+		perror("prctl(PR_SET_TSC)");
+		sigaction(SIGSEGV,&g_prev_sigsegv,NULL);
+		sigaction(SIGTRAP,&g_prev_sigtrap,NULL);
+		g_raw_clock=false;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,47 @@
+/**
+ * uefireverse - Tools to help with Reverse Engineering UEFI-based firmware
+ * Copyright (C) 2015  Jethro G. Beekman
+ * 
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef VCLOCK_H
+#define VCLOCK_H
+
+#include <time.h>
+#include <efi.h>
+
+// Virtual time, in 100ns units since start-up. Runs at the speed of the host
+// clock, except that waits are skipped in fast-forward mode.
+UINT64 vclock_now();
+
+// Lets virtual time pass until deadline. Sleeps, or in fast-forward mode
+// advances the clock instantly.
+void vclock_sleep_until(UINT64 deadline);
+
+// Advances the clock to deadline without sleeping, regardless of the mode.
+void vclock_skip_to(UINT64 deadline);
+
+void vclock_set_fast_forward(bool enable);
+bool vclock_fast_forward();
+
+// Wall clock time corresponding to the current virtual time.
+void vclock_walltime(struct timespec* ts);
+
+// Makes rdtsc/rdtscp fault and emulates them with a 1GHz counter derived from
+// virtual time. Must be called before any other threads are started.
+bool vclock_trap_rdtsc();
+
+#endif //VCLOCK_H